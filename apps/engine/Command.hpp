@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2018, 2021  Dirk Stolle
+    Copyright (C) 2017, 2018, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -37,6 +37,36 @@ class Command
     virtual bool process() = 0;
 
 
+    /** \brief Checks whether the command may be processed while the engine
+     *         is still searching for a move.
+     *
+     * \return Returns true, if the command can be processed during a search.
+     *         Returns false, if the search has to finish first.
+     * \remarks Most commands change the board or the settings of the engine,
+     *          so they have to wait for the search. Only commands like stop
+     *          or isready override this method.
+     */
+    virtual bool allowedDuringSearch() const
+    {
+      return false;
+    }
+
+
+    /** \brief Checks whether the command may be processed while the engine
+     *         is pondering, i.e. searching on the opponent's time.
+     *
+     * \return Returns true, if the command can be processed during pondering.
+     *         Returns false, if the command ends pondering.
+     * \remarks By default, this is the same as allowedDuringSearch(). Commands
+     *          that the opponent sends before or with its move (e.g. the time
+     *          left on the clocks) override this method.
+     */
+    virtual bool allowedDuringPonder() const
+    {
+      return allowedDuringSearch();
+    }
+
+
     /** \brief Virtual destructor (for derived classes).
      */
     virtual ~Command() = default;
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2018, 2021, 2022  Dirk Stolle
+    Copyright (C) 2017, 2018, 2021, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,6 +19,7 @@
 */
 
 #include "Engine.hpp"
+#include <algorithm>
 #include <sstream>
 #include "io-utils.hpp"
 #include "../../libsimple-chess/evaluation/CompoundCreator.hpp"
@@ -28,6 +29,40 @@
 namespace simplechess
 {
 
+/** \brief Gets the coordinate notation of a move, e.g. "e2e4" or "a7a8q".
+ *
+ * \param move  the move
+ * \return Returns the move in coordinate notation.
+ */
+std::string moveToString(const Move& move)
+{
+  std::string result;
+  result += simplechess::column(move.from);
+  result += std::to_string(simplechess::row(move.from));
+  result += simplechess::column(move.to);
+  result += std::to_string(simplechess::row(move.to));
+  switch (move.promoteTo)
+  {
+    case PieceType::queen:
+         result += 'q';
+         break;
+    case PieceType::rook:
+         result += 'r';
+         break;
+    case PieceType::bishop:
+         result += 'b';
+         break;
+    case PieceType::knight:
+         result += 'n';
+         break;
+    default:
+         break;
+  }
+  return result;
+}
+
+const unsigned int Engine::defaultSearchDepth = 100;
+
 Engine& Engine::get()
 {
   static Engine instance;
@@ -40,15 +75,36 @@ Engine::Engine()
   mProtocolVersion(1), // assume version 1 until we get more information
   mEnginePlayer(Colour::none), // engine plays no side be default
   mBoard(Board()),
+  mHistory(std::vector<std::uint64_t>()),
   evaluators(CompoundEvaluator()),
-  mSearchDepth(2), // default search depth: two ply search
+  mSearchDepth(defaultSearchDepth),
+  mThreads(1),
+  mSearchOptions(SearchOptions()),
   mForceMode(false),
+  mPost(false),
   mTiming(Timing()),
-  mQueue(std::deque<std::unique_ptr<Command> >()) // empty queue
+  mTable(TranspositionTable::defaultSize),
+  mOrdering(MoveOrdering()),
+  mPredicted(std::vector<Move>()),
+  mPredictedHash(0),
+  mQueue(std::deque<std::unique_ptr<Command> >()), // empty queue
+  mSearchThread(),
+  mSearching(false),
+  mStopSearch(false),
+  mDiscardMove(false),
+  mWaitingForSearch(false),
+  mPondering(false),
+  mPonderMove(Move()),
+  mPonderEnabled(false)
 {
   CompoundCreator::getDefault(evaluators);
 }
 
+Engine::~Engine()
+{
+  cancelSearch();
+}
+
 bool Engine::quitRequested() const
 {
   return mQuit.load();
@@ -56,6 +112,11 @@ bool Engine::quitRequested() const
 
 void Engine::terminate()
 {
+  // The move of a ponder search is not needed any more, but the move of a
+  // normal search is still sent.
+  if (!pondering())
+    stopSearch();
+  waitForSearch();
   mQuit.store(true);
 }
 
@@ -88,6 +149,29 @@ Board& Engine::board()
   return mBoard;
 }
 
+bool Engine::playMove(const Field from, const Field to, const PieceType promoteTo)
+{
+  const std::uint64_t previous = mBoard.hash();
+  if (!mBoard.move(from, to, promoteTo))
+    return false;
+  // Positions before a pawn move or a capture can never occur again.
+  if (mBoard.halfmovesFifty() == 0)
+    mHistory.clear();
+  else
+    mHistory.push_back(previous);
+  return true;
+}
+
+const std::vector<std::uint64_t>& Engine::history() const
+{
+  return mHistory;
+}
+
+void Engine::clearHistory()
+{
+  mHistory.clear();
+}
+
 Colour Engine::player() const
 {
   return mEnginePlayer;
@@ -123,6 +207,21 @@ void Engine::setSearchDepth(const unsigned int newSearchDepth)
   mSearchDepth = newSearchDepth;
 }
 
+unsigned int Engine::threads() const
+{
+  return mThreads;
+}
+
+void Engine::setThreads(const unsigned int count)
+{
+  mThreads = std::clamp(count, 1u, Search::maxThreads);
+}
+
+SearchOptions& Engine::searchOptions()
+{
+  return mSearchOptions;
+}
+
 bool Engine::forceMode() const
 {
   return mForceMode;
@@ -133,11 +232,34 @@ void Engine::setForceMode(const bool newForceMode)
   mForceMode = newForceMode;
 }
 
+bool Engine::post() const
+{
+  return mPost.load();
+}
+
+void Engine::setPost(const bool newPost)
+{
+  mPost.store(newPost);
+}
+
 Timing& Engine::timing()
 {
   return mTiming;
 }
 
+TranspositionTable& Engine::transpositionTable()
+{
+  return mTable;
+}
+
+void Engine::clearSearchState()
+{
+  mTable.clear();
+  mOrdering.clear();
+  mPredicted.clear();
+  mPredictedHash = 0;
+}
+
 void Engine::addCommand(std::unique_ptr<Command>&& com)
 {
   if (com != nullptr)
@@ -160,6 +282,10 @@ int Engine::processQueue()
   while (!mQueue.empty() && !mQuit.load())
   {
     const auto& cmd = mQueue.front();
+    // Pondering ends, when the opponent does something that the engine did
+    // not expect: waitForSearch() cancels the ponder search.
+    if (pondering() ? !cmd->allowedDuringPonder() : !cmd->allowedDuringSearch())
+      waitForSearch();
     cmd->process();
     mQueue.pop_front();
     ++processedCommands;
@@ -180,24 +306,188 @@ void Engine::move()
     return;
   }
 
-  // Let's find a suitable move.
-  Search s(board());
-  // Search for best move with defined search depth.
-  s.search(evaluators, mSearchDepth);
+  move(timeControlLimits(), false, false);
+}
+
+void Engine::move(const SearchLimits& limits, const bool infinite, const bool ponder)
+{
+  // Only one search at a time.
+  waitForSearch();
+  if (!ponder)
+    mTiming.self().start();
+  mStopSearch.store(false);
+  mDiscardMove.store(false);
+  mPondering.store(ponder);
+  mSearching.store(true);
+  mSearchThread = std::thread(&Engine::think, this, board(), history(), limits, infinite, ponder);
+}
+
+SearchLimits Engine::timeControlLimits() const
+{
+  // The time for the move is derived from the time control. The search does
+  // not start a new iteration after half of the time, and it is aborted when
+  // all of the time is used.
+  const auto budget = std::chrono::duration_cast<std::chrono::milliseconds>(mTiming.moveBudget());
+  SearchLimits limits;
+  limits.depth = mSearchDepth;
+  limits.softTime = budget / 2;
+  limits.hardTime = budget;
+  return limits;
+}
+
+bool Engine::searching() const
+{
+  return mSearching.load();
+}
+
+void Engine::stopSearch()
+{
+  mStopSearch.store(true);
+}
+
+void Engine::waitForSearch()
+{
+  if (!mSearchThread.joinable())
+    return;
+  // The search thread must not start to ponder while somebody waits for it.
+  // And a ponder search never ends on its own, so it gets cancelled.
+  mWaitingForSearch.store(true);
+  if (mPondering.load())
+  {
+    // The discard flag has to be set before the other flags, so that the
+    // search thread cannot send its move in between.
+    mDiscardMove.store(true);
+    mStopSearch.store(true);
+    mPondering.store(false);
+  }
+  mSearchThread.join();
+  mWaitingForSearch.store(false);
+  mDiscardMove.store(false);
+}
+
+void Engine::cancelSearch()
+{
+  mDiscardMove.store(true);
+  mStopSearch.store(true);
+  mPondering.store(false);
+  waitForSearch();
+}
+
+bool Engine::pondering() const
+{
+  return mPondering.load();
+}
+
+const Move& Engine::ponderMove() const
+{
+  return mPonderMove;
+}
+
+void Engine::ponderHit()
+{
+  // From now on the search runs on the engine's time.
+  mTiming.self().start();
+  mPondering.store(false);
+}
+
+bool Engine::ponderEnabled() const
+{
+  return mPonderEnabled;
+}
+
+void Engine::setPonderEnabled(const bool enable)
+{
+  mPonderEnabled = enable;
+}
+
+void Engine::think(Board position, std::vector<std::uint64_t> history, SearchLimits limits, const bool infinite, bool ponder)
+{
+  // Commands that could change the board wait until the search is finished
+  // (or cancel a ponder search), so the board can be used without locks.
+  bool searchAgain = true;
+  while (searchAgain)
+  {
+    Search s(position, mTable);
+    s.setThreads(mThreads);
+    s.setOptions(mSearchOptions);
+    s.setStopSignal(mStopSearch);
+    s.setGameHistory(history);
+    s.setInfoCallback([this](const SearchInfo& info) { sendInfo(info); });
+    if (ponder)
+      s.setPonderSignal(mPondering);
+    // Start with what the previous search has learned: killers, history and
+    // the rest of its principal variation, if the game followed it.
+    s.setMoveOrdering(mOrdering);
+    if ((mPredictedHash == position.hash()) && !mPredicted.empty())
+      s.usePredictedVariation(mPredicted);
+    // Search for best move with iterative deepening until either a limit is
+    // reached or the search is stopped.
+    s.search(evaluators, limits);
+    rememberSearch(s, position);
+    // Neither an infinite search nor a ponder search may send its move before
+    // it is stopped or the opponent has played the expected move.
+    while ((infinite || mPondering.load()) && !mStopSearch.load())
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    if (mDiscardMove.load())
+      break;
+    const Board searched(position);
+    searchAgain = sendMove(s, position, limits);
+    if (searchAgain)
+    {
+      // The ponder position is two plys after the searched position, so
+      // both positions in between become part of the history.
+      Board afterMove(searched);
+      const Move& best = s.principalVariation().front();
+      afterMove.move(best.from, best.to, best.promoteTo);
+      history.push_back(searched.hash());
+      history.push_back(afterMove.hash());
+      // Ponder on the expected reply of the opponent. The stop flag is reset
+      // before the discard flag is checked, so that a cancellation in
+      // between cannot get lost.
+      mStopSearch.store(false);
+      if (mDiscardMove.load())
+        break;
+      ponder = true;
+    }
+  } // while
+  mPondering.store(false);
+  mSearching.store(false);
+}
+
+void Engine::rememberSearch(const Search& s, const Board& position)
+{
+  // The next search starts two plys later, after the reply of the opponent.
+  mOrdering = s.moveOrdering();
+  mOrdering.age(2);
+  mPredicted.clear();
+  mPredictedHash = 0;
+  const std::vector<Move>& pv = s.principalVariation();
+  if (pv.size() < 3)
+    return;
+  Board board(position);
+  if (!board.move(pv[0].from, pv[0].to, pv[0].promoteTo)
+      || !board.move(pv[1].from, pv[1].to, pv[1].promoteTo))
+    return;
+  mPredictedHash = board.hash();
+  mPredicted.assign(pv.begin() + 2, pv.end());
+}
+
+bool Engine::sendMove(const Search& s, Board& ponderPosition, SearchLimits& ponderLimits)
+{
   // Did the search find any moves?
   if (!s.hasMove())
   {
     // No moves have been found. This is probably due to the fact that the
     // engine has been checkmated, so give up here.
     sendCommand("resign");
-    return;
+    return false;
   }
-  const auto bestMove = s.bestMove();
-  const Field from = std::get<0>(bestMove);
-  const Field to = std::get<1>(bestMove);
-  const PieceType promo = std::get<2>(bestMove);
+  const std::vector<Move>& pv = s.principalVariation();
+  const Move best = pv.front();
   // Perform move.
-  if (!board().move(from, to, promo))
+  if (!playMove(best.from, best.to, best.promoteTo))
   {
     // The move the engine found is not allowed. (Should not happen, but who knows?)
     // To avoid any complication, the engine will resign here.
@@ -210,21 +500,99 @@ void Engine::move()
     {
       sendCommand("1-0 {Black resigns because it could not find an acceptable move}");
     }
-    return;
+    return false;
+  }
+  mTiming.countMove();
+  // Stop own clock and start the opponent's clock.
+  mTiming.self().stop();
+  mTiming.opponent().start();
+
+  // In xboard mode the engine decides on its own when to ponder. Everything
+  // for that has to be set up before the move is sent, because the opponent
+  // may reply immediately. Furthermore, as soon as the ponder flag is set, the
+  // main thread processes time and move commands without waiting for this
+  // thread, so board and timing must not be used here after that point.
+  bool ponderNext = false;
+  if ((mProtocol == Protocol::XBoard) && mPonderEnabled && (pv.size() >= 2))
+  {
+    ponderPosition = board();
+    if (ponderPosition.move(pv[1].from, pv[1].to, pv[1].promoteTo))
+    {
+      mPonderMove = pv[1];
+      ponderLimits = timeControlLimits();
+      mPondering.store(true);
+      // If the main thread waits for this thread, then it did not see the
+      // ponder flag, or it has already reset it. Either way, do not ponder.
+      ponderNext = !mWaitingForSearch.load();
+      if (!ponderNext)
+        mPondering.store(false);
+    }
   }
+
   // Send move to xboard or UCI-compatible engine.
-  std::ostringstream oss;
+  std::string command;
   switch (mProtocol)
   {
     case Protocol::XBoard:
-         oss << "move ";
+         command = "move " + moveToString(best);
          break;
     default: // UCI
-         oss << "bestmove ";
+         command = "bestmove " + moveToString(best);
+         // Tell the GUI which move the engine would like to ponder on.
+         if (pv.size() >= 2)
+           command += " ponder " + moveToString(pv[1]);
          break;
   }
-  oss << simplechess::column(from) << simplechess::row(from)
-      << simplechess::column(to) << simplechess::row(to);
+  sendCommand(command);
+  return ponderNext;
+}
+
+void Engine::sendInfo(const SearchInfo& info)
+{
+  const auto ms = std::max(info.time.count(), static_cast<decltype(info.time.count())>(1));
+  std::ostringstream oss;
+  if (mProtocol == Protocol::XBoard)
+  {
+    // xboard only expects one line per iteration: ply, score in centipawns,
+    // time in centiseconds, nodes and the principal variation.
+    if (!info.completed || !post())
+      return;
+    int score = info.score;
+    if (score >= Search::mateScore - 1000)
+      score = 100000 + (Search::mateScore - score + 1) / 2;
+    else if (score <= -Search::mateScore + 1000)
+      score = -100000 - (Search::mateScore + score) / 2;
+    oss << info.depth << " " << score << " " << info.time.count() / 10
+        << " " << info.nodes;
+    for (const Move& move : info.pv)
+    {
+      oss << " " << moveToString(move);
+    }
+    sendCommand(oss.str());
+    return;
+  }
+
+  // UCI
+  oss << "info depth " << info.depth << " seldepth " << info.selectiveDepth;
+  if (info.completed)
+  {
+    if (info.score >= Search::mateScore - 1000)
+      oss << " score mate " << (Search::mateScore - info.score + 1) / 2;
+    else if (info.score <= -Search::mateScore + 1000)
+      oss << " score mate -" << (Search::mateScore + info.score) / 2;
+    else
+      oss << " score cp " << info.score;
+  }
+  oss << " nodes " << info.nodes << " nps " << info.nodes * 1000 / ms
+      << " time " << info.time.count() << " hashfull " << info.hashfull;
+  if (info.completed && !info.pv.empty())
+  {
+    oss << " pv";
+    for (const Move& move : info.pv)
+    {
+      oss << " " << moveToString(move);
+    }
+  }
   sendCommand(oss.str());
 }
 
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2018, 2021, 2022  Dirk Stolle
+    Copyright (C) 2017, 2018, 2021, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,11 +22,18 @@
 #define SIMPLE_CHESS_ENGINE_HPP
 
 #include <atomic>
+#include <cstdint>
 #include <deque>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "../../libsimple-chess/data/Board.hpp"
 #include "../../libsimple-chess/evaluation/CompoundEvaluator.hpp"
+#include "../../libsimple-chess/search/MoveOrdering.hpp"
+#include "../../libsimple-chess/search/Search.hpp"
+#include "../../libsimple-chess/search/SearchOptions.hpp"
+#include "../../libsimple-chess/search/TranspositionTable.hpp"
 #include "time/Timing.hpp"
 #include "Command.hpp"
 #include "Protocol.hpp"
@@ -53,6 +60,10 @@ class Engine
     Engine(Engine&& e) = delete;
 
 
+    /** \brief Destructor. Stops any running search. */
+    ~Engine();
+
+
     /** \brief Checks whether the engine has received the quit command.
      *
      * \return Returns true, if the quit command has been received.
@@ -63,6 +74,7 @@ class Engine
     /** \brief Request the termination of command processing and any further
      *         engine activity to the earliest possible convenient moment.
      * \remarks Only call this method if you want to shutdown the engine.
+     *          A running search is stopped, and its move is still sent.
      */
     void terminate();
 
@@ -102,6 +114,32 @@ class Engine
     Board& board();
 
 
+    /** \brief Performs a move on the engine's board and records the previous
+     *         position in the game history.
+     *
+     * \param from       field where the move starts
+     * \param to         field where the move ends
+     * \param promoteTo  type of piece that a pawn shall be promoted to
+     * \return Returns true, if the move was performed. Returns false, if the
+     *         move is not allowed; the board is unchanged then.
+     */
+    bool playMove(const Field from, const Field to, const PieceType promoteTo);
+
+
+    /** \brief Gets the hashes of the positions before the current position
+     *         of the board that may still repeat, i.e. the positions since the
+     *         last pawn move or capture, oldest first.
+     *
+     * \return Returns the hashes of the game history.
+     */
+    const std::vector<std::uint64_t>& history() const;
+
+
+    /** \brief Forgets the game history, e.g. because a new position is set up.
+     */
+    void clearHistory();
+
+
     /** \brief Gets the side that is controlled by the engine.
      *
      * \return Returns colour of the player that is played by the engine.
@@ -131,23 +169,50 @@ class Engine
     bool setEvaluator(CompoundEvaluator&& eval);
 
 
-    /** \brief Gets the current search depth of the engine.
+    /** The default maximum search depth of the engine in plys / half moves.
+        Usually the time for a move runs out long before this depth is reached. */
+    static const unsigned int defaultSearchDepth;
+
+
+    /** \brief Gets the current maximum search depth of the engine.
      *
-     * \return Returns the search depth in plys / half moves.
-     * \remarks This may currently be one only.
+     * \return Returns the maximum search depth in plys / half moves.
      */
     unsigned int searchDepth() const;
 
 
-    /** \brief Sets a new search depth for the engine.
+    /** \brief Sets a new maximum search depth for the engine.
      *
-     * \param newSearchDepth the new search depth in plys / half moves
-     * \remarks The engine may ignore the search depth, if it is larger than
-     *          what the engine can currently handle.
+     * \param newSearchDepth the new maximum search depth in plys / half moves
+     * \remarks Larger search depths need exponentially more time, so be
+     *          careful what you wish for.
      */
     void setSearchDepth(const unsigned int newSearchDepth);
 
 
+    /** \brief Gets the number of threads the engine uses for the search.
+     *
+     * \return Returns the number of search threads.
+     */
+    unsigned int threads() const;
+
+
+    /** \brief Sets the number of threads the engine uses for the search.
+     *
+     * \param count  the new number of search threads, will be clamped to the
+     *               range [1;Search::maxThreads]
+     */
+    void setThreads(const unsigned int count);
+
+
+    /** \brief Gets the switches for the selective parts of the search.
+     *
+     * \return Returns a reference to the search options of the engine.
+     * \remarks Changes to the options take effect at the next search.
+     */
+    SearchOptions& searchOptions();
+
+
     /** \brief Checks whether the engine is currently in force mode.
      *
      * \return Returns true, if engine is in force mode. Returns false otherwise.
@@ -162,6 +227,21 @@ class Engine
     void setForceMode(const bool newForceMode);
 
 
+    /** \brief Checks whether the engine sends thinking output to xboard.
+     *
+     * \return Returns true, if thinking output is on.
+     * \remarks UCI always gets the search statistics via info lines.
+     */
+    bool post() const;
+
+
+    /** \brief Turns thinking output for xboard on or off.
+     *
+     * \param newPost true to turn thinking output on, false to turn it off
+     */
+    void setPost(const bool newPost);
+
+
     /** \brief Gets the timing control of the engine.
      *
      * \return timing control instance
@@ -169,6 +249,22 @@ class Engine
     Timing& timing();
 
 
+    /** \brief Gets the transposition table that is used by the engine's search.
+     *
+     * \return Returns a reference to the transposition table.
+     */
+    TranspositionTable& transpositionTable();
+
+
+    /** \brief Clears everything the search keeps between moves, i. e. the
+     *         transposition table, killer moves and history values, and the
+     *         predicted line of play.
+     * \remarks Use this when a new game starts, because the results of the
+     *          previous game are of no use anymore.
+     */
+    void clearSearchState();
+
+
     /** \brief Adds another command to the command queue.
      *
      * \param com  the command that shall be added
@@ -193,25 +289,184 @@ class Engine
     /** \brief Processes all remaining commands in the queue.
      *
      * \return Returns the number of processed commands.
+     * \remarks Commands that are not allowed during a search wait until the
+     *          running search (if any) is finished.
      */
     int processQueue();
 
 
     /** \brief Ask the engine to think about and eventually perform the next
      *         move for the current player.
+     *
+     * \remarks The search runs in a separate thread, so this method returns
+     *          immediately. The search thread performs and sends the move
+     *          when the search is finished.
      */
     void move();
+
+
+    /** \brief Ask the engine to think about and eventually perform the next
+     *         move for the current player within the given limits.
+     *
+     * \param limits    limits for the search
+     * \param infinite  if true, the move is not sent before stopSearch() is
+     *                  called, even if the search has finished earlier
+     * \param ponder    if true, the search ponders on the opponent's time:
+     *                  time limits do not apply and the move is not sent until
+     *                  ponderHit() or stopSearch() is called
+     * \remarks The search runs in a separate thread, so this method returns
+     *          immediately. Unlike move() without parameters, this method
+     *          does not use the time control settings of the engine.
+     */
+    void move(const SearchLimits& limits, const bool infinite, const bool ponder);
+
+
+    /** \brief Checks whether the engine is searching for a move.
+     *
+     * \return Returns true, if a search is running.
+     */
+    bool searching() const;
+
+
+    /** \brief Tells a running search to stop as soon as possible.
+     *
+     * \remarks The search still performs and sends the best move it has
+     *          found so far. Nothing happens, if no search is running.
+     */
+    void stopSearch();
+
+
+    /** \brief Waits until the running search (if any) is finished.
+     *
+     * \remarks A ponder search is cancelled, because it would never finish.
+     */
+    void waitForSearch();
+
+
+    /** \brief Stops a running search and waits for it, but without sending
+     *         its move, e.g. because the opponent did not play the move the
+     *         engine has pondered on.
+     */
+    void cancelSearch();
+
+
+    /** \brief Checks whether the engine is pondering, i.e. searching on the
+     *         opponent's time.
+     *
+     * \return Returns true, if the engine is pondering.
+     */
+    bool pondering() const;
+
+
+    /** \brief Gets the move of the opponent that the engine expects while it
+     *         ponders in xboard mode.
+     *
+     * \return Returns the expected move. Only valid while pondering() is true.
+     */
+    const Move& ponderMove() const;
+
+
+    /** \brief Tells the engine that the opponent played the expected move.
+     *
+     * \remarks The running ponder search goes on as a normal search with time
+     *          limits, and its move is sent when the search is finished.
+     *          In xboard mode the caller has to perform the opponent's move
+     *          on the board first.
+     */
+    void ponderHit();
+
+
+    /** \brief Checks whether pondering is enabled for xboard.
+     *
+     * \return Returns true, if the engine ponders after its own moves.
+     * \remarks UCI GUIs tell the engine when to ponder via "go ponder".
+     */
+    bool ponderEnabled() const;
+
+
+    /** \brief Enables or disables pondering for xboard.
+     *
+     * \param enable  true to enable pondering (xboard command hard), false to
+     *                disable it (xboard command easy)
+     */
+    void setPonderEnabled(const bool enable);
   private:
+    /** \brief Gets the search limits from the time control settings.
+     *
+     * \return Returns the limits for the next move of the engine.
+     */
+    SearchLimits timeControlLimits() const;
+
+
+
+    /** \brief Searches for the best move, performs it and sends it to the GUI.
+     *
+     * \param position  the position to search
+     * \param history   hashes of the positions before it, see history()
+     * \param limits    limits for the search
+     * \param infinite  whether to wait for stopSearch() before sending the move
+     * \param ponder    whether the search starts as ponder search
+     * \remarks This is the function of the search thread. In xboard mode with
+     *          pondering enabled, the thread goes on with a ponder search
+     *          on the expected reply after it has sent its move.
+     */
+    void think(Board position, std::vector<std::uint64_t> history, SearchLimits limits, const bool infinite, bool ponder);
+
+
+    /** \brief Keeps the move ordering data and the predicted line of play of
+     *         a finished search for the search of the next move.
+     *
+     * \param s         the finished search
+     * \param position  the position that was searched
+     */
+    void rememberSearch(const Search& s, const Board& position);
+
+
+    /** \brief Performs the best move of a finished search and sends it.
+     *
+     * \param s               the finished search
+     * \param ponderPosition  receives the position to ponder on, if any
+     * \param ponderLimits    receives the limits of the ponder search, if any
+     * \return Returns true, if the engine shall ponder on ponderPosition.
+     *         Returns false otherwise.
+     */
+    bool sendMove(const Search& s, Board& ponderPosition, SearchLimits& ponderLimits);
+
+
+    /** \brief Sends search statistics to the GUI, e.g. as UCI info line.
+     *
+     * \param info  the search statistics
+     */
+    void sendInfo(const SearchInfo& info);
+
+
+
     std::atomic<bool> mQuit; /**< quit flag - it true, termination has been requested */
     Protocol mProtocol; /**< the chess protocol (UCI or XBoard) */
     unsigned int mProtocolVersion; /**< xboard protocol version */
     Colour mEnginePlayer; /**< colour that is controlled by the engine */
     Board mBoard; /**< current chess board */
+    std::vector<std::uint64_t> mHistory; /**< hashes of the positions before the current board since the last pawn move or capture */
     CompoundEvaluator evaluators; /**< evaluators that are used by the engine */
-    unsigned int mSearchDepth; /**< search depth of the engine in plys */
+    unsigned int mSearchDepth; /**< maximum search depth of the engine in plys */
+    unsigned int mThreads; /**< number of search threads */
+    SearchOptions mSearchOptions; /**< switches for the selective parts of the search */
     bool mForceMode; /**< whether the engine is in force mode */
+    std::atomic<bool> mPost; /**< whether to send thinking output to xboard */
     Timing mTiming; /**< time controls */
+    TranspositionTable mTable; /**< transposition table of the search */
+    MoveOrdering mOrdering; /**< killer moves and history of the last search */
+    std::vector<Move> mPredicted; /**< predicted moves after the expected reply of the opponent */
+    std::uint64_t mPredictedHash; /**< hash of the position where mPredicted starts */
     std::deque<std::unique_ptr<Command> > mQueue; /**< command queue */
+    std::thread mSearchThread; /**< thread of the current or last search */
+    std::atomic<bool> mSearching; /**< whether a search is running */
+    std::atomic<bool> mStopSearch; /**< signals the search to stop */
+    std::atomic<bool> mDiscardMove; /**< whether the search must not send its move */
+    std::atomic<bool> mWaitingForSearch; /**< whether the main thread waits for the search thread */
+    std::atomic<bool> mPondering; /**< whether the search is pondering */
+    Move mPonderMove; /**< expected move of the opponent while pondering in xboard mode */
+    bool mPonderEnabled; /**< whether pondering is enabled for xboard */
 
 
     /** Default constructor - private due to singleton. */
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2021  Dirk Stolle
+    Copyright (C) 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -31,12 +31,21 @@ namespace simplechess
 template<typename Parser>
 void ParseLoop()
 {
+  // Process commands that were queued before the loop, e.g. the protocol's
+  // initialization command. GUIs wait for the answer to it.
+  Engine::get().processQueue();
   while (!Engine::get().quitRequested())
   {
     std::string command;
-    std::getline(std::cin, command, '\n');
+    if (!std::getline(std::cin, command, '\n'))
+    {
+      // End of input: nobody can send commands any more, so stop the engine.
+      Engine::get().terminate();
+      break;
+    }
     Parser::parse(command);
-    // TODO: separate thread for command processing by engine
+    // Searches run in a separate thread, so only commands that have to wait
+    // for the search block the loop.
     Engine::get().processQueue();
   } // while
 }
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2020  Dirk Stolle
+    Copyright (C) 2017, 2020, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -47,12 +47,13 @@ void sendCommand(const std::string& cmd)
 #if defined(_WIN32)
   // Since there is no <unistd.h> with write() on Windows, use streams instead.
   // However, this may be slow with the explicit flush.
-  std::cout << cmd << "\n";
+  std::cout << (cmd + "\n");
   std::cout.flush();
 #elif defined(__linux__) || defined(linux)
-  // Send via unbuffered system call.
-  write(1, cmd.c_str(), cmd.size());
-  write(1, "\n", 1);
+  // Send via unbuffered system call. Command and line break are written at
+  // once, so that lines of the search thread and the main thread do not mix.
+  const std::string line = cmd + "\n";
+  write(1, line.c_str(), line.size());
 #else
   #error Unknown operating system!
 #endif
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017  Dirk Stolle
+    Copyright (C) 2017, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -32,7 +32,8 @@ Timing::Timing()
   mConventionalTime(std::chrono::minutes(5)),
   mIncrementalBase(std::chrono::minutes(2)),
   mIncrementalIncrement(std::chrono::seconds(12)),
-  mExactSecondsPerMove(std::chrono::seconds(30))
+  mExactSecondsPerMove(std::chrono::seconds(30)),
+  mMovesDone(0)
 {
 }
 
@@ -74,11 +75,12 @@ void Timing::setConventional(const int moves, const std::chrono::seconds& time)
 
 void Timing::setIncremental(const std::chrono::seconds& base, const std::chrono::seconds& increment)
 {
-  // We use std::max() to ensure values of at least 10 seconds base time and an
-  // increment of at least one second, because zero or negative increment values
-  // are not useful, and neither is a base time below ten seconds.
+  // We use std::max() to ensure values of at least 10 seconds base time,
+  // because a base time below ten seconds is not useful. The increment is
+  // kept as it is (except for negative values), because an increment of zero
+  // is a valid time control: sudden death.
   mIncrementalBase = std::max(base, std::chrono::seconds(10));
-  mIncrementalIncrement = std::max(increment, std::chrono::seconds(1));
+  mIncrementalIncrement = std::max(increment, std::chrono::seconds(0));
   if (!mSelfClock.running())
   {
     mSelfClock.reset(base);
@@ -102,4 +104,53 @@ void Timing::setExact(const std::chrono::seconds& secondsPerMove)
   }
 }
 
+unsigned int Timing::movesDone() const
+{
+  return mMovesDone;
+}
+
+void Timing::countMove()
+{
+  ++mMovesDone;
+}
+
+void Timing::resetMoves()
+{
+  mMovesDone = 0;
+}
+
+centiseconds Timing::moveBudget() const
+{
+  // Keep up to half a second as reserve, but never more than a tenth of the
+  // available time.
+  const centiseconds maxReserve(50);
+  if (mMode == TimeControlMode::exact)
+  {
+    // Time is not carried over to the next move, so use all of it.
+    const centiseconds perMove = mExactSecondsPerMove;
+    return perMove - std::min(perMove / 10, maxReserve);
+  }
+
+  const centiseconds remaining = std::max(mSelfClock.remaining(), centiseconds(0));
+  const centiseconds available = remaining - std::min(remaining / 10, maxReserve);
+  centiseconds budget(0);
+  if (mMode == TimeControlMode::incremental)
+  {
+    // Assume that the game lasts for another 30 moves, and use most of the
+    // increment right away. The increment is only added after the move, so
+    // it may use at most half of the available time.
+    const centiseconds increment = mIncrementalIncrement;
+    budget = available / 30 + std::min(increment * 3 / 4, available / 2);
+  }
+  else
+  {
+    // Conventional mode: Distribute the time evenly among the moves up to the
+    // next time control.
+    const unsigned int moves = static_cast<unsigned int>(mConventionalMoves);
+    const unsigned int movesLeft = moves - (mMovesDone % moves);
+    budget = available / movesLeft;
+  }
+  return std::max(std::min(budget, available), centiseconds(1));
+}
+
 } // namespace
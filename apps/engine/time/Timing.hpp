@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017  Dirk Stolle
+    Copyright (C) 2017, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -88,6 +88,35 @@ class Timing
      * \param secondsPerMove number of seconds per move
      */
     void setExact(const std::chrono::seconds& secondsPerMove);
+
+
+    /** \brief Gets the number of moves the engine has made since the last
+     *         call of resetMoves().
+     *
+     * \return Returns the number of moves made by the engine.
+     */
+    unsigned int movesDone() const;
+
+
+    /** \brief Increases the number of moves made by the engine by one.
+     */
+    void countMove();
+
+
+    /** \brief Resets the number of moves made by the engine to zero, e.g. at
+     *         the start of a new game.
+     */
+    void resetMoves();
+
+
+    /** \brief Calculates the time the engine may spend on its next move.
+     *
+     * \return Returns the time budget for the next move in centiseconds.
+     * \remarks The budget depends on the time control mode and the time that
+     *          remains on the clock of the engine. A small part of the time is
+     *          kept as reserve for the communication with the GUI.
+     */
+    centiseconds moveBudget() const;
   private:
     TimeControlMode mMode; /**< current time control mode */
     Clock mSelfClock; /**< clock of the engine */
@@ -100,6 +129,7 @@ class Timing
     std::chrono::seconds mIncrementalIncrement; /**< increment per move in incremental mode */
     // exact mode settings
     std::chrono::seconds mExactSecondsPerMove; /**< seconds per move in exact mode */
+    unsigned int mMovesDone; /**< number of moves made by the engine */
 }; // class
 
 } // namespace
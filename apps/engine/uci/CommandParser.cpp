@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2021  Dirk Stolle
+    Copyright (C) 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -24,56 +24,205 @@
 #include "IsReady.hpp"
 #include "Move.hpp"
 #include "NewGame.hpp"
+#include "PonderHit.hpp"
 #include "Position.hpp"
 #include "Quit.hpp"
+#include "SetOption.hpp"
+#include "Stop.hpp"
 #include "Uci.hpp"
 #include "../Command.hpp"
 #include "../Engine.hpp"
 #include "../io-utils.hpp"
+#include "../../../libsimple-chess/data/ForsythEdwardsNotation.hpp"
+#include "../../../util/strings.hpp"
 
 namespace simplechess::uci
 {
 
 const std::regex regExMove = std::regex("^([a-h][1-8])([a-h][1-8])([qbnr])?$");
+const std::regex regExSetOption = std::regex("^setoption name (.+?)(?: value (.*))?$");
+
+/** \brief Parses the parameters of a go command.
+ *
+ * \param commandString  the full command string, starting with "go"
+ * \param params         variable that will receive the parsed parameters
+ * \return Returns true, if the parameters could be parsed.
+ *         Returns false otherwise.
+ * \remarks Unknown parameters are ignored, as the UCI specification demands.
+ */
+bool parseGo(const std::string& commandString, GoParameters& params)
+{
+  const std::vector<std::string> parts = util::split(commandString, ' ');
+  for (std::size_t i = 1; i < parts.size(); ++i)
+  {
+    const std::string& name = parts[i];
+    if (name == "infinite")
+    {
+      params.infinite = true;
+      continue;
+    }
+    if (name == "ponder")
+    {
+      params.ponder = true;
+      continue;
+    }
+    if ((name != "wtime") && (name != "btime") && (name != "winc")
+        && (name != "binc") && (name != "movestogo") && (name != "movetime")
+        && (name != "depth") && (name != "nodes") && (name != "mate"))
+    {
+      continue;
+    }
+    int value = 0;
+    if ((i + 1 >= parts.size()) || !util::stringToInt(parts[i + 1], value))
+    {
+      sendCommand("Error: go parameter " + name + " needs an integer value");
+      return false;
+    }
+    ++i;
+    // Times may be negative, when the time is already up.
+    if ((value < 0) && (name != "wtime") && (name != "btime"))
+    {
+      sendCommand("Error: go parameter " + name + " must not be negative");
+      return false;
+    }
+    const std::chrono::milliseconds time(value);
+    if (name == "wtime")
+      params.whiteTime = time;
+    else if (name == "btime")
+      params.blackTime = time;
+    else if (name == "winc")
+      params.whiteIncrement = time;
+    else if (name == "binc")
+      params.blackIncrement = time;
+    else if (name == "movetime")
+      params.moveTime = time;
+    else if (name == "movestogo")
+      params.movesToGo = static_cast<unsigned int>(value);
+    else if (name == "depth")
+      params.depth = static_cast<unsigned int>(value);
+    else if (name == "nodes")
+      params.nodes = static_cast<std::uint64_t>(value);
+    else // mate
+      params.mate = static_cast<unsigned int>(value);
+  } // for
+  return true;
+}
+
+/** \brief Parses a move in long algebraic notation, e.g. "e2e4" or "e7e8q".
+ *
+ * \param text  the text to parse
+ * \return Returns a move command, if the text is a move.
+ *         Returns nullptr otherwise.
+ */
+std::unique_ptr<Command> parseMove(const std::string& text)
+{
+  std::smatch matches;
+  if (!std::regex_search(text, matches, regExMove))
+    return nullptr;
+  const Field origin = toField(matches.str(1).at(0), matches.str(1).at(1) - '1' + 1);
+  const Field destination = toField(matches.str(2).at(0), matches.str(2).at(1) - '1' + 1);
+  PieceType promoteTo = PieceType::none;
+  if (matches[3].matched)
+  {
+    if (matches.str(3) == "b")
+      promoteTo = PieceType::bishop;
+    else if (matches.str(3) == "n")
+      promoteTo = PieceType::knight;
+    else if (matches.str(3) == "q")
+      promoteTo = PieceType::queen;
+    else if (matches.str(3) == "r")
+      promoteTo = PieceType::rook;
+  }
+  return std::unique_ptr<Command>(new Move(origin, destination, promoteTo));
+}
+
+/** \brief Parses a position command and queues the commands for it.
+ *
+ * \param commandString  the full command string, starting with "position "
+ * \remarks The command is split into a Position command and one Move command
+ *          per move after "moves", so that the engine knows the game history
+ *          that led to the position.
+ */
+void parsePosition(const std::string& commandString)
+{
+  std::string setup = commandString.substr(9);
+  std::string moves;
+  const auto movesStart = setup.find(" moves");
+  if (movesStart != std::string::npos)
+  {
+    moves = setup.substr(movesStart + 6);
+    setup.erase(movesStart);
+  }
+  std::string fen;
+  if (setup == "startpos")
+    fen = FEN::defaultInitialPosition;
+  else if (setup.substr(0, 4) == "fen ")
+    fen = setup.substr(4);
+  else
+  {
+    sendCommand("Error: Unknown command " + commandString);
+    return;
+  }
+  Engine::get().addCommand(std::unique_ptr<Command>(new Position(fen)));
+  for (const std::string& text : util::split(moves, ' '))
+  {
+    if (text.empty())
+      continue;
+    std::unique_ptr<Command> move = parseMove(text);
+    if (move == nullptr)
+    {
+      sendCommand("Error: invalid move " + text);
+      return;
+    }
+    Engine::get().addCommand(std::move(move));
+  } // for
+}
 
 void CommandParser::parse(const std::string& commandString)
 {
   if (commandString.empty())
     return;
   std::smatch matches;
-  if(std::regex_search(commandString, matches, regExMove))
+  std::unique_ptr<Command> move = parseMove(commandString);
+  if (move != nullptr)
   {
-    const Field origin = toField(matches.str(1).at(0), matches.str(1).at(1) - '1' + 1);
-    const Field destination = toField(matches.str(2).at(0), matches.str(2).at(1) - '1' + 1);
-    PieceType promoteTo = PieceType::none;
-    if (matches[3].matched)
-    {
-      if (matches.str(3) == "b")
-        promoteTo = PieceType::bishop;
-      else if (matches.str(3) == "n")
-        promoteTo = PieceType::knight;
-      else if (matches.str(3) == "q")
-        promoteTo = PieceType::queen;
-      else if (matches.str(3) == "r")
-        promoteTo = PieceType::rook;
-    }
-    Engine::get().addCommand(std::unique_ptr<Command>(new Move(origin, destination, promoteTo)));
+    Engine::get().addCommand(std::move(move));
   } // move command
   else if (commandString == "isready")
   {
     Engine::get().addCommand(std::unique_ptr<Command>(new IsReady()));
   }
+  else if (commandString == "ponderhit")
+  {
+    Engine::get().addCommand(std::unique_ptr<Command>(new PonderHit()));
+  }
+  else if (commandString == "stop")
+  {
+    Engine::get().addCommand(std::unique_ptr<Command>(new Stop()));
+  }
   else if (commandString == "go")
   {
     Engine::get().addCommand(std::unique_ptr<Command>(new Go()));
   }
-  else if ((commandString == "ucinewgame") || (commandString == "position startpos"))
+  else if (commandString.substr(0, 3) == "go ")
+  {
+    GoParameters params;
+    if (parseGo(commandString, params))
+    {
+      Engine::get().addCommand(std::unique_ptr<Command>(new Go(params)));
+    }
+  }
+  else if (commandString == "ucinewgame")
   {
     Engine::get().addCommand(std::unique_ptr<Command>(new NewGame()));
   }
-  else if (commandString.substr(0, 13) == "position fen ")
+  else if (commandString.substr(0, 9) == "position ")
+  {
+    parsePosition(commandString);
+  }
+  else if (std::regex_search(commandString, matches, regExSetOption))
   {
-    Engine::get().addCommand(std::unique_ptr<Command>(new Position(commandString.substr(13))));
+    Engine::get().addCommand(std::unique_ptr<Command>(new SetOption(matches.str(1), matches.str(2))));
   }
   else if (commandString == "uci")
   {
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2021  Dirk Stolle
+    Copyright (C) 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,18 +19,91 @@
 */
 
 #include "Go.hpp"
+#include <algorithm>
 #include "../Engine.hpp"
 
 namespace simplechess::uci
 {
 
+Go::Go()
+: params(GoParameters())
+{
+}
+
+Go::Go(const GoParameters& params)
+: params(params)
+{
+}
+
 bool Go::process()
 {
   Engine& engine = Engine::get();
   engine.setForceMode(false);
   engine.setPlayer(engine.board().toMove());
-  engine.move();
+  const bool hasLimits = params.whiteTime.has_value() || params.blackTime.has_value()
+      || params.moveTime.has_value() || params.depth.has_value()
+      || params.nodes.has_value() || params.mate.has_value() || params.infinite
+      || params.ponder;
+  if (!hasLimits)
+  {
+    engine.move();
+    return true;
+  }
+  // When pondering, the GUI has already played the expected move of the
+  // opponent, so the limits are the ones for the engine's next move.
+  engine.move(limits(engine.board().toMove(), engine.searchDepth()), params.infinite, params.ponder);
   return true;
 }
 
+const GoParameters& Go::parameters() const
+{
+  return params;
+}
+
+SearchLimits Go::limits(const Colour side, const unsigned int maxDepth) const
+{
+  using std::chrono::milliseconds;
+
+  SearchLimits result;
+  result.depth = params.depth.value_or(maxDepth);
+  if (params.mate.has_value())
+  {
+    // A mate in n moves is found by a search of 2n-1 plys.
+    const unsigned int mateDepth = 2 * std::max(params.mate.value(), 1u) - 1;
+    result.depth = std::min(result.depth, mateDepth);
+  }
+  result.nodes = params.nodes.value_or(0);
+  if (params.infinite)
+    return result;
+
+  // Keep up to 50 milliseconds as reserve for the communication with the GUI,
+  // but never more than a tenth of the time.
+  const milliseconds maxReserve(50);
+  if (params.moveTime.has_value())
+  {
+    // Time is not carried over to the next move, so use all of it.
+    const milliseconds moveTime = std::max(params.moveTime.value(), milliseconds(0));
+    const milliseconds limit = std::max(moveTime - std::min(moveTime / 10, maxReserve), milliseconds(1));
+    result.softTime = limit;
+    result.hardTime = limit;
+    return result;
+  }
+
+  const auto& time = (side == Colour::black) ? params.blackTime : params.whiteTime;
+  if (!time.has_value())
+    return result;
+  const auto& increment = (side == Colour::black) ? params.blackIncrement : params.whiteIncrement;
+  // Some GUIs send negative times when the engine is already out of time.
+  const milliseconds remaining = std::max(time.value(), milliseconds(0));
+  const milliseconds available = remaining - std::min(remaining / 10, maxReserve);
+  // Without movestogo it is sudden death, so assume that the game lasts for
+  // another 30 moves. Most of the increment can be used right away.
+  const unsigned int movesLeft = std::max(params.movesToGo.value_or(30), 1u);
+  const milliseconds inc = std::max(increment.value_or(milliseconds(0)), milliseconds(0));
+  const milliseconds target = std::min(available / movesLeft + inc * 3 / 4, available);
+  result.softTime = std::max(target / 2, milliseconds(1));
+  result.hardTime = std::max(std::min(target * 2, available), milliseconds(1));
+  return result;
+}
+
 } // namespace
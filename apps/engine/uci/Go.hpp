@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2021  Dirk Stolle
+    Copyright (C) 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,20 +21,85 @@
 #ifndef SIMPLE_CHESS_UCI_GO_HPP
 #define SIMPLE_CHESS_UCI_GO_HPP
 
+#include <chrono>
+#include <cstdint>
+#include <optional>
 #include "../Command.hpp"
+#include "../../../libsimple-chess/data/Piece.hpp"
+#include "../../../libsimple-chess/search/SearchLimits.hpp"
 
 namespace simplechess::uci
 {
 
+/** \brief Parameters of the UCI go command.
+ *
+ * Parameters that were not given have no value.
+ */
+struct GoParameters
+{
+  std::optional<std::chrono::milliseconds> whiteTime; /**< time left on white's clock (wtime) */
+  std::optional<std::chrono::milliseconds> blackTime; /**< time left on black's clock (btime) */
+  std::optional<std::chrono::milliseconds> whiteIncrement; /**< white's increment per move (winc) */
+  std::optional<std::chrono::milliseconds> blackIncrement; /**< black's increment per move (binc) */
+  std::optional<unsigned int> movesToGo; /**< moves until the next time control (movestogo) */
+  std::optional<std::chrono::milliseconds> moveTime; /**< exact time for this move (movetime) */
+  std::optional<unsigned int> depth; /**< maximum search depth in plys (depth) */
+  std::optional<std::uint64_t> nodes; /**< maximum number of nodes (nodes) */
+  std::optional<unsigned int> mate; /**< search for a mate in that many moves (mate) */
+  bool infinite = false; /**< search until the stop command arrives (infinite) */
+  bool ponder = false; /**< search on the opponent's time until ponderhit or stop (ponder) */
+}; // struct
+
 /** Command for calculating a move. */
 class Go: public Command
 {
   public:
+    /** \brief Constructor for a go command without any parameters.
+     */
+    Go();
+
+
+    /** \brief Constructor.
+     *
+     * \param params  parameters of the go command
+     */
+    explicit Go(const GoParameters& params);
+
+
     /** \brief Processes the command, i.e. performs required actions.
      *
      * \return True if command was processed successfully.
+     * \remarks A go command without any parameters uses the time control
+     *          settings of the engine.
      */
     bool process() final;
+
+
+    /** \brief Gets the parameters of the command.
+     *
+     * \return Returns the parameters of the go command.
+     */
+    const GoParameters& parameters() const;
+
+
+    /** \brief Calculates the search limits from the parameters.
+     *
+     * \param side      the side that is to move
+     * \param maxDepth  maximum search depth, if the command has no depth
+     * \return Returns the limits for the search.
+     * \remarks Parameters map to the limits as follows:
+     *          depth and mate limit the depth (a mate in n moves needs a
+     *          depth of 2n-1 plys), nodes is a hard limit, movetime is both
+     *          a soft and a hard limit. The clock of the side to move
+     *          (wtime/btime with winc/binc and movestogo) gives a target time
+     *          for the move; the soft limit is half of the target, and the
+     *          hard limit is twice the target. No limit ever exceeds the time
+     *          left on the clock minus a small reserve. infinite removes all
+     *          time limits. For ponder the limits only start with ponderhit.
+     */
+    SearchLimits limits(const Colour side, const unsigned int maxDepth) const;
+  private:
+    GoParameters params; /**< parameters of the command */
 }; // class
 
 } // namespace
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2021  Dirk Stolle
+    Copyright (C) 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -31,4 +31,9 @@ bool IsReady::process()
   return true;
 }
 
+bool IsReady::allowedDuringSearch() const
+{
+  return true;
+}
+
 } // namespace
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2021  Dirk Stolle
+    Copyright (C) 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -42,6 +42,14 @@ class IsReady : public Command
      * \return True if command was processed successfully.
      */
     bool process() final;
+
+
+    /** \brief Checks whether the command may be processed while the engine
+     *         is still searching for a move.
+     *
+     * \return Returns true, because the command does not have to wait.
+     */
+    bool allowedDuringSearch() const final;
 }; // class
 
 } // namespace
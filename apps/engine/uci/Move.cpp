@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2021  Dirk Stolle
+    Copyright (C) 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -37,9 +37,8 @@ Move::Move(const Field ori, const Field dest, const PieceType promo)
 bool Move::process()
 {
   Engine& engine = Engine::get();
-  Board& board = engine.board();
   // perform move
-  if (!board.move(origin, destination, promoteTo))
+  if (!engine.playMove(origin, destination, promoteTo))
   {
     std::ostringstream oss;
     oss << "Illegal move: " << column(origin) << row(origin)
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2021  Dirk Stolle
+    Copyright (C) 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -35,6 +35,7 @@ bool NewGame::process()
   }
   // Set White on move.
   board.setToMove(Colour::white);
+  Engine::get().clearHistory();
   // Leave force mode...
   Engine::get().setForceMode(false);
   // ... and set the engine to play Black.
@@ -46,9 +47,12 @@ bool NewGame::process()
   // Use wall clock for time measurement. Stop clocks.
   timing.self().stop();
   timing.opponent().stop();
+  timing.resetMoves();
   // TODO: Do not ponder on this move, even if pondering is on.
   // Reset previously set limit on search depth.
-  Engine::get().setSearchDepth(100);
+  Engine::get().setSearchDepth(Engine::defaultSearchDepth);
+  // Results of the previous game are of no use anymore.
+  Engine::get().clearSearchState();
   return true;
 }
 
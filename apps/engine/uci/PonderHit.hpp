@@ -0,0 +1,52 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_UCI_PONDERHIT_HPP
+#define SIMPLE_CHESS_UCI_PONDERHIT_HPP
+
+#include "../Command.hpp"
+
+namespace simplechess::uci
+{
+
+/** \brief Class that handles the UCI ponderhit command, i.e. the opponent
+ *         has played the move that the engine has pondered on.
+ */
+class PonderHit : public Command
+{
+  public:
+    /** \brief Processes the command, i.e. performs required actions.
+     *
+     * \return True if command was processed successfully.
+     */
+    bool process() final;
+
+
+    /** \brief Checks whether the command may be processed while the engine
+     *         is still searching for a move.
+     *
+     * \return Returns true, because the command changes the running search.
+     */
+    bool allowedDuringSearch() const final;
+}; // class
+
+} // namespace
+
+#endif // SIMPLE_CHESS_UCI_PONDERHIT_HPP
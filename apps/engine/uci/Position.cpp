@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2021  Dirk Stolle
+    Copyright (C) 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -40,6 +40,9 @@ bool Position::process()
     sendCommand("Error: invalid FEN given");
     return false;
   }
+  // Moves of the position command follow as separate commands, and they
+  // build up the history again.
+  Engine::get().clearHistory();
   // Leave force mode...
   Engine::get().setForceMode(false);
   // ... and set the engine to play the side that is to move.
@@ -51,9 +54,8 @@ bool Position::process()
   // Use wall clock for time measurement. Stop clocks.
   timing.self().stop();
   timing.opponent().stop();
+  timing.resetMoves();
   // TODO: Do not ponder on this move, even if pondering is on.
-  // Reset previously set limit on search depth.
-  Engine::get().setSearchDepth(100);
   return true;
 }
 
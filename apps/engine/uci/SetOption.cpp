@@ -0,0 +1,120 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "SetOption.hpp"
+#include <algorithm>
+#include <cctype>
+#include "../io-utils.hpp"
+#include "../Engine.hpp"
+#include "../../../libsimple-chess/search/Search.hpp"
+#include "../../../util/strings.hpp"
+
+namespace simplechess::uci
+{
+
+SetOption::SetOption(const std::string& name, const std::string& value)
+: name(name),
+  value(value)
+{
+}
+
+bool SetOption::process()
+{
+  // Option names are not case sensitive in UCI.
+  std::string lowerName = name;
+  std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+  if (lowerName == "hash")
+  {
+    int megabytes = -1;
+    if (!util::stringToInt(value, megabytes) || (megabytes < 1)
+        || (static_cast<std::size_t>(megabytes) > TranspositionTable::maximumSize))
+    {
+      sendCommand("info string Error: invalid value for option Hash: " + value);
+      return false;
+    }
+    Engine::get().transpositionTable().resize(megabytes);
+    return true;
+  }
+  if (lowerName == "threads")
+  {
+    int count = -1;
+    if (!util::stringToInt(value, count) || (count < 1)
+        || (static_cast<unsigned int>(count) > Search::maxThreads))
+    {
+      sendCommand("info string Error: invalid value for option Threads: " + value);
+      return false;
+    }
+    Engine::get().setThreads(count);
+    return true;
+  }
+  if (lowerName == "ponder")
+  {
+    // Nothing to do here: The GUI tells the engine when to ponder via
+    // "go ponder", and the option only tells the GUI that it may do so.
+    return true;
+  }
+  // Switches for the selective search, e.g. to compare the playing strength
+  // with and without a technique.
+  bool* const searchSwitch =
+        (lowerName == "nullmove") ? &Engine::get().searchOptions().nullMovePruning
+      : (lowerName == "latemovereductions") ? &Engine::get().searchOptions().lateMoveReductions
+      : (lowerName == "futility") ? &Engine::get().searchOptions().futilityPruning
+      : (lowerName == "razoring") ? &Engine::get().searchOptions().razoring
+      : nullptr;
+  if (searchSwitch != nullptr)
+  {
+    std::string lowerValue = value;
+    std::transform(lowerValue.begin(), lowerValue.end(), lowerValue.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    if ((lowerValue != "true") && (lowerValue != "false"))
+    {
+      sendCommand("info string Error: invalid value for option " + name + ": " + value);
+      return false;
+    }
+    *searchSwitch = lowerValue == "true";
+    return true;
+  }
+  if (lowerName == "clear hash")
+  {
+    Engine::get().transpositionTable().clear();
+    return true;
+  }
+
+  sendCommand("info string Error: unknown option " + name);
+  return false;
+}
+
+void SetOption::sendOptions()
+{
+  sendCommand("option name Hash type spin default "
+              + std::to_string(TranspositionTable::defaultSize)
+              + " min 1 max " + std::to_string(TranspositionTable::maximumSize));
+  sendCommand("option name Clear Hash type button");
+  sendCommand("option name Threads type spin default 1 min 1 max "
+              + std::to_string(Search::maxThreads));
+  sendCommand("option name Ponder type check default false");
+  sendCommand("option name NullMove type check default true");
+  sendCommand("option name LateMoveReductions type check default true");
+  sendCommand("option name Futility type check default true");
+  sendCommand("option name Razoring type check default true");
+}
+
+} // namespace
@@ -0,0 +1,62 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_UCI_SETOPTION_HPP
+#define SIMPLE_CHESS_UCI_SETOPTION_HPP
+
+#include "../Command.hpp"
+#include <string>
+
+namespace simplechess::uci
+{
+
+/** Command for changing an engine option via "setoption name ... value ...". */
+class SetOption: public Command
+{
+  public:
+    /** \brief Constructor.
+     *
+     * \param name   name of the option
+     * \param value  new value of the option, may be empty for options
+     *               without value
+     */
+    SetOption(const std::string& name, const std::string& value);
+
+
+    /** \brief Processes the command, i.e. performs required actions.
+     *
+     * \return True if command was processed successfully.
+     */
+    bool process() final;
+
+
+    /** \brief Sends the option declarations of all supported options.
+     *
+     * \remarks This is part of the reply to the uci command.
+     */
+    static void sendOptions();
+  private:
+    std::string name; /**< name of the option */
+    std::string value; /**< new value of the option */
+}; // class
+
+} // namespace
+
+#endif // SIMPLE_CHESS_UCI_SETOPTION_HPP
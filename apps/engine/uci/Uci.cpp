@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2021  Dirk Stolle
+    Copyright (C) 2017, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,6 +19,7 @@
 */
 
 #include "Uci.hpp"
+#include "SetOption.hpp"
 #include <iostream>
 #include "../io-utils.hpp"
 #include "../Engine.hpp"
@@ -32,6 +33,7 @@ bool Uci::process()
   Engine::get().setProtocol(Protocol::UCI);
   sendCommand("id name simple-chess " + version);
   sendCommand("id author Dirk Stolle");
+  SetOption::sendOptions();
   sendCommand("uciok");
   std::cout.flush();
   return true;
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2018, 2021, 2022  Dirk Stolle
+    Copyright (C) 2017, 2018, 2021, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,14 +20,19 @@
 
 #include "CommandParser.hpp"
 #include <regex>
+#include "Cores.hpp"
 #include "Draw.hpp"
 #include "ExactTime.hpp"
 #include "Error.hpp"
 #include "Force.hpp"
 #include "Go.hpp"
 #include "Level.hpp"
+#include "Memory.hpp"
+#include "MoveNow.hpp"
 #include "New.hpp"
 #include "Ping.hpp"
+#include "Ponder.hpp"
+#include "Post.hpp"
 #include "ProtocolVersion.hpp"
 #include "Quit.hpp"
 #include "ResultCmd.hpp"
@@ -78,6 +83,10 @@ void CommandParser::parse(const std::string& commandString)
   {
     Engine::get().addCommand(std::unique_ptr<Command>(new Quit()));
   }
+  else if (commandString == "?")
+  {
+    Engine::get().addCommand(std::unique_ptr<Command>(new MoveNow()));
+  }
   else if ((commandString.substr(0, 9) == "protover ") && (commandString.size() > 9))
   {
     int ver = -1;
@@ -107,16 +116,10 @@ void CommandParser::parse(const std::string& commandString)
   {
     Engine::get().addCommand(std::unique_ptr<Command>(new New()));
   }
-  else if (commandString == "hard")
+  else if ((commandString == "hard") || (commandString == "easy"))
   {
-    // Turn on pondering (i. e. "thinking" on the opponent's time).
-    // No operation required, we currently ignore this.
-  }
-  else if (commandString == "easy")
-  {
-    // Turn off pondering.
-    // No operation required, we currently do not support this.
-    // Pondering is always off.
+    // Turn pondering (i. e. "thinking" on the opponent's time) on or off.
+    Engine::get().addCommand(std::unique_ptr<Command>(new Ponder(commandString == "hard")));
   }
   else if (commandString.substr(0, 6) == "level ")
   {
@@ -193,7 +196,7 @@ void CommandParser::parse(const std::string& commandString)
   }
   else if ((commandString == "post") || (commandString == "nopost"))
   {
-    // No operation required, we currently ignore this.
+    Engine::get().addCommand(std::unique_ptr<Command>(new Post(commandString == "post")));
   }
   else if (commandString == "go")
   {
@@ -209,6 +212,36 @@ void CommandParser::parse(const std::string& commandString)
     }
     Engine::get().addCommand(std::unique_ptr<Command>(new SetTime(centiS, commandString.substr(0,4) == "otim")));
   }
+  else if (commandString.substr(0, 6) == "cores ")
+  {
+    int cores = -1;
+    if (!util::stringToInt(commandString.substr(6), cores))
+    {
+      Engine::get().addCommand(std::unique_ptr<Command>(new Error("number of cores must be an integer", commandString)));
+      return;
+    }
+    if (cores < 1)
+    {
+      Engine::get().addCommand(std::unique_ptr<Command>(new Error("number of cores must be at least one", commandString)));
+      return;
+    }
+    Engine::get().addCommand(std::unique_ptr<Command>(new Cores(cores)));
+  }
+  else if (commandString.substr(0, 7) == "memory ")
+  {
+    int megabytes = -1;
+    if (!util::stringToInt(commandString.substr(7), megabytes))
+    {
+      Engine::get().addCommand(std::unique_ptr<Command>(new Error("memory size must be an integer", commandString)));
+      return;
+    }
+    if (megabytes < 1)
+    {
+      Engine::get().addCommand(std::unique_ptr<Command>(new Error("memory size must be at least one megabyte", commandString)));
+      return;
+    }
+    Engine::get().addCommand(std::unique_ptr<Command>(new Memory(megabytes)));
+  }
   else if (commandString == "ping")
   {
     Engine::get().addCommand(std::unique_ptr<Command>(new Error("no ping number given", "ping")));
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2021  Dirk Stolle
+    Copyright (C) 2017, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -31,7 +31,9 @@ ExactTime::ExactTime(const std::chrono::seconds& secsPerMove)
 
 bool ExactTime::process()
 {
-  Engine::get().timing().setExact(secondsPerMove);
+  Timing& timing = Engine::get().timing();
+  timing.setMode(TimeControlMode::exact);
+  timing.setExact(secondsPerMove);
   return true;
 }
 
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2021  Dirk Stolle
+    Copyright (C) 2017, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -32,9 +32,7 @@ bool Go::process()
   auto& eng = Engine::get();
   eng.setForceMode(false);
   eng.timing().opponent().stop();
-  eng.timing().self().start();
   eng.move();
-  eng.timing().self().stop();
   return true;
 }
 
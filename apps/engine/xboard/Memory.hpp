@@ -0,0 +1,61 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_XBOARD_MEMORY_HPP
+#define SIMPLE_CHESS_XBOARD_MEMORY_HPP
+
+#include <cstddef>
+#include "../Command.hpp"
+
+namespace simplechess::xboard
+{
+
+/** \brief Class that handles the memory command.
+ */
+class Memory : public Command
+{
+  public:
+    /** \brief Constructor.
+     *
+     * \param megabytes  the new size of the transposition table in MB
+     */
+    Memory(const std::size_t megabytes);
+
+
+    /** \brief Processes the command, i.e. performs required actions.
+     *
+     * \return True if command was processed successfully.
+     */
+    bool process() final;
+
+
+    /** \brief Gets the requested size of the transposition table.
+     *
+     * \return Returns the size in megabytes.
+     */
+    std::size_t megabytes() const;
+  private:
+    std::size_t mMegabytes; /**< size in megabytes */
+}; // class
+
+} // namespace
+
+
+#endif // SIMPLE_CHESS_XBOARD_MEMORY_HPP
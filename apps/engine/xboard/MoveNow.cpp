@@ -0,0 +1,44 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "MoveNow.hpp"
+#include "../Engine.hpp"
+
+namespace simplechess::xboard
+{
+
+bool MoveNow::process()
+{
+  // The search thread sends the best move it has found so far. If there is
+  // no search, then the command is ignored, as the protocol requires.
+  // A ponder search runs on the opponent's time, so there is nothing to
+  // move yet.
+  if (Engine::get().pondering())
+    return true;
+  Engine::get().stopSearch();
+  return true;
+}
+
+bool MoveNow::allowedDuringSearch() const
+{
+  return true;
+}
+
+} // namespace
@@ -0,0 +1,60 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_XBOARD_PONDER_HPP
+#define SIMPLE_CHESS_XBOARD_PONDER_HPP
+
+#include "../Command.hpp"
+
+namespace simplechess::xboard
+{
+
+/** \brief Class that handles the hard and easy commands, i.e. turns
+ *         pondering on or off.
+ */
+class Ponder : public Command
+{
+  public:
+    /** \brief Constructor.
+     *
+     * \param enable  true for the hard command, false for easy
+     */
+    explicit Ponder(const bool enable);
+
+
+    /** \brief Processes the command, i.e. performs required actions.
+     *
+     * \return True if command was processed successfully.
+     */
+    bool process() final;
+
+
+    /** \brief Checks whether the command turns pondering on.
+     *
+     * \return Returns true for hard, false for easy.
+     */
+    bool enabled() const;
+  private:
+    bool mEnable; /**< whether to turn pondering on */
+}; // class
+
+} // namespace
+
+#endif // SIMPLE_CHESS_XBOARD_PONDER_HPP
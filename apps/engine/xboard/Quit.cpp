@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2021  Dirk Stolle
+    Copyright (C) 2017, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -30,4 +30,9 @@ bool Quit::process()
   return true;
 }
 
+bool Quit::allowedDuringSearch() const
+{
+  return true;
+}
+
 } // namespace
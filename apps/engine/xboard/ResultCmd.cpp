@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2021  Dirk Stolle
+    Copyright (C) 2017, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -43,6 +43,7 @@ bool ResultCmd::process()
 
   // Reset board and the one side that is played by the engine.
   eng.board() = Board();
+  eng.clearHistory();
   eng.setPlayer(Colour::none);
   eng.setForceMode(false);
   return true;
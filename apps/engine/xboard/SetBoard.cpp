@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2018, 2021  Dirk Stolle
+    Copyright (C) 2018, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -42,6 +42,7 @@ bool SetBoard::process()
     return true;
   }
   Engine::get().board() = board;
+  Engine::get().clearHistory();
   return true;
 }
 
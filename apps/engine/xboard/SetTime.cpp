@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2021, 2022  Dirk Stolle
+    Copyright (C) 2017, 2021, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -44,4 +44,9 @@ bool SetTime::process()
   return true;
 }
 
+bool SetTime::allowedDuringPonder() const
+{
+  return true;
+}
+
 } // namespace
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2021  Dirk Stolle
+    Copyright (C) 2017, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -44,6 +44,15 @@ class SetTime : public Command
      * \return True if command was processed successfully.
      */
     bool process() final;
+
+
+    /** \brief Checks whether the command may be processed while the engine
+     *         is pondering.
+     *
+     * \return Returns true, because xboard sends the clock times
+     *         right before the move of the opponent.
+     */
+    bool allowedDuringPonder() const final;
   private:
     int mCentiseconds; /**< amount of centiseconds left */
     bool mOpponent; /**< true for opponent, false for engine time */
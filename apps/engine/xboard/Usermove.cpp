@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2021  Dirk Stolle
+    Copyright (C) 2017, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -37,9 +37,23 @@ Usermove::Usermove(const Field ori, const Field dest, const PieceType promo)
 bool Usermove::process()
 {
   Engine& engine = Engine::get();
+  if (engine.pondering())
+  {
+    if (engine.ponderMove() == Move(origin, destination, promoteTo))
+    {
+      // Ponder hit: The ponder search already started from the position
+      // after this move, so let it go on as normal search.
+      engine.playMove(origin, destination, promoteTo);
+      engine.timing().opponent().stop();
+      engine.ponderHit();
+      return true;
+    }
+    // The opponent played another move, so the ponder search is useless.
+    engine.cancelSearch();
+  }
   Board& b = engine.board();
   // perform move
-  if (!b.move(origin, destination, promoteTo))
+  if (!engine.playMove(origin, destination, promoteTo))
   {
     std::ostringstream oss;
     oss << "Illegal move: " << column(origin) << row(origin)
@@ -70,16 +84,15 @@ bool Usermove::process()
   // Make own move, but only if not in force mode and it is engine's turn.
   if (!engine.forceMode() && (engine.player() == b.toMove()))
   {
-    // start clock
-    engine.timing().self().start();
-    // start making own move
+    // Start making own move. The engine takes care of the clocks.
     engine.move();
-    // stop own clock ...
-    engine.timing().self().stop();
-    // ... and start clock of opponent
-    engine.timing().opponent().start();
   }
   return true;
 }
 
+bool Usermove::allowedDuringPonder() const
+{
+  return true;
+}
+
 } // namespace
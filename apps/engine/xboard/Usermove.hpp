@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2021  Dirk Stolle
+    Copyright (C) 2017, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -46,6 +46,15 @@ class Usermove: public Command
      * \return True if command was processed successfully.
      */
     bool process() final;
+
+
+    /** \brief Checks whether the command may be processed while the engine
+     *         is pondering.
+     *
+     * \return Returns true, because the move of the opponent decides
+     *         whether the engine has pondered on the right move.
+     */
+    bool allowedDuringPonder() const final;
   private:
     Field origin; /**< field of origin for the move */
     Field destination; /**< field of destination for the move */
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2020, 2021, 2025  Dirk Stolle
+    Copyright (C) 2020, 2021, 2025, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -32,7 +32,9 @@ namespace simplechess
 {
 
 CompetitionData::CompetitionData(const std::vector<std::string_view>& allowedEvaluators)
-: stopRequested(false),
+: searchDepth(Competition::defaultDepth),
+  searchOptions(SearchOptions()),
+  stopRequested(false),
   isCompeting(false),
   evaluators(createEvaluators(allowedEvaluators)),
   wins(),
@@ -41,6 +43,12 @@ CompetitionData::CompetitionData(const std::vector<std::string_view>& allowedEva
 {
 }
 
+void CompetitionData::setSearch(const unsigned int depth, const SearchOptions& options)
+{
+  searchDepth = depth;
+  searchOptions = options;
+}
+
 std::vector<std::unique_ptr<Evaluator>> CompetitionData::createEvaluators(const std::vector<std::string_view>& allowedEvaluators)
 {
   using vecsize_t = std::vector<std::string_view>::size_type;
@@ -130,7 +138,7 @@ void CompetitionData::single_threaded_compete()
       }
       if (idxWhite == idxBlack)
         continue;
-      const Result r = Competition::compete(*evaluators[idxWhite], *evaluators[idxBlack]);
+      const Result r = Competition::compete(*evaluators[idxWhite], *evaluators[idxBlack], searchDepth, searchOptions);
 
       switch (r)
       {
@@ -199,7 +207,7 @@ void CompetitionData::multi_threaded_compete(unsigned int threads)
         }
         if (idxWhite == idxBlack)
           continue;
-        const Result r = Competition::compete(*evaluators[idxWhite], *evaluators[idxBlack]);
+        const Result r = Competition::compete(*evaluators[idxWhite], *evaluators[idxBlack], searchDepth, searchOptions);
 
         {
           std::lock_guard<std::mutex> guard(mutuallyExclusive);
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2020, 2021, 2025  Dirk Stolle
+    Copyright (C) 2020, 2021, 2025, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -27,6 +27,7 @@
 #include <vector>
 #include "../../libsimple-chess/data/Result.hpp"
 #include "../../libsimple-chess/evaluation/Evaluator.hpp"
+#include "../../libsimple-chess/search/SearchOptions.hpp"
 
 namespace simplechess
 {
@@ -49,6 +50,15 @@ class CompetitionData
      */
     bool compete(unsigned int threads = 1);
 
+
+    /** \brief Sets the search depth and the search options for all games.
+     *
+     * \param depth    search depth in plys
+     * \param options  switches for the selective parts of the search
+     * \remarks This has to be called before compete() to have any effect.
+     */
+    void setSearch(const unsigned int depth, const SearchOptions& options);
+
     /** \brief Requests to stop an ongoing competition.
      *
      * \remarks This may not stop the compete() immediately, it may still go on
@@ -92,6 +102,8 @@ class CompetitionData
      */
     void multi_threaded_compete(unsigned int threads);
 
+    unsigned int searchDepth;
+    SearchOptions searchOptions;
     volatile bool stopRequested;
     volatile bool isCompeting;
     std::vector<std::unique_ptr<Evaluator>> evaluators;
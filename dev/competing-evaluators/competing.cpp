@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2020, 2021, 2025  Dirk Stolle
+    Copyright (C) 2020, 2021, 2025, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -66,7 +66,8 @@ void Competition::compete(const std::vector<std::string_view>& allowedEvaluators
 }
 #endif
 
-Result Competition::compete(const Evaluator& white, const Evaluator& black)
+Result Competition::compete(const Evaluator& white, const Evaluator& black,
+                            const unsigned int depth, const SearchOptions& options)
 {
   Board board;
   if (!board.fromFEN(FEN::defaultInitialPosition))
@@ -80,7 +81,7 @@ Result Competition::compete(const Evaluator& white, const Evaluator& black)
       return Result::Draw;
     }
 
-    const auto bestMove = Search::search(board, board.toMove() == Colour::white ? white : black , 2);
+    const auto bestMove = Search::search(board, board.toMove() == Colour::white ? white : black, depth, options);
     if (std::get<0>(bestMove) == Field::none)
     {
       // Evaluator could not find a valid move. That usually means the player
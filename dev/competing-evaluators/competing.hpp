@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2020, 2021, 2025  Dirk Stolle
+    Copyright (C) 2020, 2021, 2025, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -27,6 +27,7 @@
 #include <vector>
 #include "../../libsimple-chess/data/Result.hpp"
 #include "../../libsimple-chess/evaluation/Evaluator.hpp"
+#include "../../libsimple-chess/search/SearchOptions.hpp"
 
 namespace simplechess
 {
@@ -41,6 +42,11 @@ class Competition
     static const std::vector<std::string_view> allEvaluators;
 
 
+    /** \brief default search depth in plys for the moves of both players
+     */
+    static constexpr unsigned int defaultDepth = 2;
+
+
     #ifndef SIMPLE_CHESS_NO_COMPETITION_DATA
     /** \brief Performs the whole competition between evaluators.
      *
@@ -56,10 +62,14 @@ class Competition
      *
      * \param white   evaluator for the white player
      * \param black   evaluator for the black player
+     * \param depth   search depth in plys for the moves of both players
+     * \param options switches for the selective parts of the search
      * \return Returns the result of the game.
      *         Returns Result::Unknown, if an error occurred.
      */
-    static Result compete(const Evaluator& white, const Evaluator& black);
+    static Result compete(const Evaluator& white, const Evaluator& black,
+                          const unsigned int depth = defaultDepth,
+                          const SearchOptions& options = SearchOptions());
 }; // class
 
 } // namespace
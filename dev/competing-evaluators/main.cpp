@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2020  Dirk Stolle
+    Copyright (C) 2020, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -47,7 +47,16 @@ void showHelp()
             << "\n"
             << "options:\n"
             << "  -? | --help     - shows this help message and exits\n"
-            << "  -v | --version  - shows version information and exits\n";
+            << "  -v | --version  - shows version information and exits\n"
+            << "  -t N | --threads N\n"
+            << "                  - sets the number of threads to use to N\n"
+            << "  -d N | --depth N\n"
+            << "                  - sets the search depth for all moves to N plys,\n"
+            << "                    default is " << simplechess::Competition::defaultDepth << "\n"
+            << "  --no-null-move  - disables null move pruning in the search\n"
+            << "  --no-lmr        - disables late move reductions in the search\n"
+            << "  --no-futility   - disables futility pruning in the search\n"
+            << "  --no-razoring   - disables razoring in the search\n";
 }
 
 simplechess::CompetitionData compData(simplechess::Competition::allEvaluators);
@@ -124,6 +133,8 @@ BOOL windows_signal_handler(DWORD ctrlSignal)
 int main(int argc, char** argv)
 {
   unsigned int threads = 0;
+  unsigned int depth = 0;
+  simplechess::SearchOptions options;
 
   if ((argc > 1) && (argv != nullptr))
   {
@@ -178,6 +189,55 @@ int main(int argc, char** argv)
           return simplechess::rcInvalidParameter;
         }
       }
+      else if ((param == "-d") || (param == "--depth"))
+      {
+        if (depth > 0)
+        {
+          std::cout << "Error: Search depth has been specified multiple times." << std::endl;
+          return simplechess::rcInvalidParameter;
+        }
+        //enough parameters?
+        if ((i+1 < argc) && (argv[i+1] != nullptr))
+        {
+          const std::string integer = std::string(argv[i+1]);
+          int depth_num = 0;
+          if (!simplechess::util::stringToInt(integer, depth_num))
+          {
+            std::cout << "Error: \"" << integer << "\" is not an unsigned integer!" << std::endl;
+            return simplechess::rcInvalidParameter;
+          }
+          if (depth_num <= 0)
+          {
+            std::cout << "Error: Search depth has to be greater than zero." << std::endl;
+            return simplechess::rcInvalidParameter;
+          }
+          // Assign the parameter value.
+          depth = depth_num;
+          ++i; // Skip next parameter, because it's used as search depth already.
+        }
+        else
+        {
+          std::cout << "Error: You have to enter an integer value after \""
+                    << param <<"\"." << std::endl;
+          return simplechess::rcInvalidParameter;
+        }
+      }
+      else if (param == "--no-null-move")
+      {
+        options.nullMovePruning = false;
+      }
+      else if (param == "--no-lmr")
+      {
+        options.lateMoveReductions = false;
+      }
+      else if (param == "--no-futility")
+      {
+        options.futilityPruning = false;
+      }
+      else if (param == "--no-razoring")
+      {
+        options.razoring = false;
+      }
       // Should never happen.
       else
       {
@@ -240,6 +300,12 @@ int main(int argc, char** argv)
     threads = 1;
   }
 
+  if (depth == 0)
+  {
+    depth = simplechess::Competition::defaultDepth;
+  }
+  compData.setSearch(depth, options);
+
   std::cout << "Pairing all evaluator combinations, this will take quite some time..."
             << std::endl;
   if (compData.compete(threads))
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2021  Dirk Stolle
+    Copyright (C) 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,6 +20,7 @@
 
 #include <chrono>
 #include <iostream>
+#include <thread>
 #include "../competing-evaluators/competing.hpp"
 #include "../../libsimple-chess/evaluation/CompoundEvaluator.hpp"
 #include "../../libsimple-chess/evaluation/CastlingEvaluator.hpp"
@@ -28,6 +29,10 @@
 #include "../../libsimple-chess/evaluation/MaterialEvaluator.hpp"
 #include "../../libsimple-chess/evaluation/PromotionEvaluator.hpp"
 #include "../../libsimple-chess/evaluation/RootMobilityEvaluator.hpp"
+#include "../../libsimple-chess/evaluation/CompoundCreator.hpp"
+#include "../../libsimple-chess/evaluation/StaticCompound.hpp"
+#include "../../libsimple-chess/rules/Moves.hpp"
+#include "../../libsimple-chess/search/Search.hpp"
 #include "../../util/GitInfos.hpp"
 #include "../../util/ReturnCodes.hpp"
 #include "../../util/Version.hpp"
@@ -47,7 +52,138 @@ void showHelp()
             << "\n"
             << "options:\n"
             << "  -? | --help     - shows this help message and exits\n"
-            << "  -v | --version  - shows version information and exits\n";
+            << "  -v | --version  - shows version information and exits\n"
+            << "  --smp           - measures the scaling of the search with 1, 2, 4\n"
+            << "                    and 8 threads instead of playing games\n"
+            << "  --evaluators    - compares the speed of the dynamic compound evaluator\n"
+            << "                    with the statically composed evaluator instead of\n"
+            << "                    playing games\n";
+}
+
+/** \brief Measures time to depth and nodes per second of the multi-threaded
+ *         search for different numbers of threads.
+ */
+void benchmarkThreads()
+{
+  using namespace simplechess;
+
+  const std::vector<std::string> positions = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "r1bq1rk1/pp2bppp/2n1pn2/3p4/2PP4/2N1PN2/PP3PPP/R2QKB1R w KQ - 0 8"
+  };
+  const unsigned int depth = 5;
+  CompoundEvaluator evaluator;
+  CompoundCreator::getDefault(evaluator);
+  std::cout << "Search to depth " << depth << " on " << positions.size()
+            << " positions (hardware threads: " << std::thread::hardware_concurrency()
+            << ")\n";
+  for (const unsigned int threads : { 1u, 2u, 4u, 8u })
+  {
+    std::uint64_t nodes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (const std::string& fen : positions)
+    {
+      Board board;
+      board.fromFEN(fen);
+      TranspositionTable table;
+      Search search(board, table);
+      search.setThreads(threads);
+      search.search(evaluator, depth, std::chrono::hours(1));
+      nodes += search.nodes();
+    } // for
+    const auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "threads: " << threads << "  time: " << millis << " ms"
+              << "  nodes: " << nodes
+              << "  nps: " << (millis > 0 ? nodes * 1000 / millis : nodes)
+              << std::endl;
+  } // for
+}
+
+/** \brief Measures the time of one evaluator on a set of positions.
+ *
+ * \param evaluator  the evaluator
+ * \param positions  the positions to evaluate
+ * \param rounds     number of times each position is evaluated
+ */
+void benchmarkEvaluator(const simplechess::Evaluator& evaluator, const std::vector<simplechess::Board>& positions, const unsigned int rounds)
+{
+  std::int64_t sum = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < rounds; ++i)
+  {
+    for (const simplechess::Board& board : positions)
+    {
+      sum += evaluator.score(board);
+    }
+  } // for
+  const auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+  std::cout << evaluator.name() << "\n  time: " << millis << " ms  (sum of scores: "
+            << sum << ")" << std::endl;
+}
+
+/** \brief Compares the speed of the dynamic CompoundEvaluator with the
+ *         statically composed evaluator of the same evaluators.
+ */
+void benchmarkEvaluators()
+{
+  using namespace simplechess;
+
+  // Take all positions after two plies from some start positions.
+  const std::vector<std::string> fens = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "r1bq1rk1/pp2bppp/2n1pn2/3p4/2PP4/2N1PN2/PP3PPP/R2QKB1R w KQ - 0 8",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"
+  };
+  std::vector<Board> positions;
+  for (const std::string& fen : fens)
+  {
+    Board board;
+    board.fromFEN(fen);
+    MoveList moves;
+    Moves::generate(board, moves);
+    for (const Move& move : moves)
+    {
+      Board child(board);
+      child.move(move.from, move.to, move.promoteTo);
+      MoveList replies;
+      Moves::generate(child, replies);
+      for (const Move& reply : replies)
+      {
+        Board grandChild(child);
+        grandChild.move(reply.from, reply.to, reply.promoteTo);
+        positions.push_back(grandChild);
+      }
+    } // for
+  } // for
+  const unsigned int rounds = 50;
+  std::cout << "Evaluating " << positions.size() << " positions " << rounds
+            << " times each ...\n";
+
+  CompoundEvaluator dynamic;
+  dynamic.add(std::unique_ptr<Evaluator>(new MaterialEvaluator()));
+  dynamic.add(std::unique_ptr<Evaluator>(new LinearMobilityEvaluator()));
+  dynamic.add(std::unique_ptr<Evaluator>(new PromotionEvaluator()));
+  dynamic.add(std::unique_ptr<Evaluator>(new CheckEvaluator()));
+  dynamic.add(std::unique_ptr<Evaluator>(new CastlingEvaluator()));
+  benchmarkEvaluator(dynamic, positions, rounds);
+
+  const StaticCompound<MaterialEvaluator, LinearMobilityEvaluator,
+      PromotionEvaluator, CheckEvaluator, CastlingEvaluator> fused;
+  benchmarkEvaluator(fused, positions, rounds);
+
+  // Cheap evaluators show the overhead of the virtual calls more clearly, so
+  // they get more rounds.
+  CompoundEvaluator dynamicMaterial;
+  dynamicMaterial.add(std::unique_ptr<Evaluator>(new MaterialEvaluator()));
+  dynamicMaterial.add(std::unique_ptr<Evaluator>(new PromotionEvaluator()));
+  dynamicMaterial.add(std::unique_ptr<Evaluator>(new CastlingEvaluator()));
+  benchmarkEvaluator(dynamicMaterial, positions, 10 * rounds);
+
+  const StaticCompound<MaterialEvaluator, PromotionEvaluator, CastlingEvaluator> fusedMaterial;
+  benchmarkEvaluator(fusedMaterial, positions, 10 * rounds);
 }
 
 int main(int argc, char** argv)
@@ -74,6 +210,16 @@ int main(int argc, char** argv)
         showHelp();
         return 0;
       } // if help
+      else if (param == "--smp")
+      {
+        benchmarkThreads();
+        return 0;
+      } // if smp
+      else if (param == "--evaluators")
+      {
+        benchmarkEvaluators();
+        return 0;
+      } // if evaluators
       // Should never happen.
       else
       {
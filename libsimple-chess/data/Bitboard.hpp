@@ -0,0 +1,105 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_BITBOARD_HPP
+#define SIMPLE_CHESS_BITBOARD_HPP
+
+#include <cstdint>
+#include "Field.hpp"
+
+namespace simplechess
+{
+
+/** \brief Set of fields on the board, one bit per field.
+ *
+ * \remarks Bit n corresponds to the field with the numeric value n of the
+ *          Field enumeration, i.e. bit 0 is a1, bit 1 is a2, ..., bit 8 is b1
+ *          and bit 63 is h8.
+ */
+typedef std::uint64_t Bitboard;
+
+
+/** \brief Gets the bitboard that only contains the given field.
+ *
+ * \param f  the field, must not be none
+ * \return Returns a bitboard where only the bit of the given field is set.
+ */
+constexpr Bitboard fieldBit(const Field f)
+{
+  return static_cast<Bitboard>(1) << static_cast<int>(f);
+}
+
+
+/** \brief Counts the number of fields in a bitboard.
+ *
+ * \param b  the bitboard
+ * \return Returns the number of set bits.
+ */
+inline int popCount(const Bitboard b)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_popcountll(b);
+#else
+  // SWAR population count as portable fallback
+  Bitboard x = b - ((b >> 1) & 0x5555555555555555ULL);
+  x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+  x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return static_cast<int>((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+
+/** \brief Gets the field of the lowest set bit in a bitboard.
+ *
+ * \param b  the bitboard, must not be zero
+ * \return Returns the field with the lowest index in the bitboard.
+ */
+inline Field firstField(const Bitboard b)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<Field>(__builtin_ctzll(b));
+#else
+  int idx = 0;
+  Bitboard x = b;
+  while ((x & 1) == 0)
+  {
+    x >>= 1;
+    ++idx;
+  }
+  return static_cast<Field>(idx);
+#endif
+}
+
+
+/** \brief Removes the lowest set bit from a bitboard and returns its field.
+ *
+ * \param b  the bitboard, must not be zero
+ * \return Returns the field with the lowest index in the bitboard.
+ */
+inline Field popFirstField(Bitboard& b)
+{
+  const Field f = firstField(b);
+  b &= b - 1;
+  return f;
+}
+
+} // namespace
+
+#endif // SIMPLE_CHESS_BITBOARD_HPP
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2016, 2017, 2018, 2021  Dirk Stolle
+    Copyright (C) 2016, 2017, 2018, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,6 +21,8 @@
 #include "Board.hpp"
 #include <cmath>
 #include <unordered_map>
+#include "Material.hpp"
+#include "Zobrist.hpp"
 #include "../rules/check.hpp"
 #include "../rules/Moves.hpp"
 #include "../../util/strings.hpp"
@@ -44,17 +46,61 @@ constexpr char nextColumn(const char column)
   return nextCol;
 }
 
+#ifdef DEBUG
+/** \brief Checks whether the incrementally updated hash and material balance
+ *         of a board match the values that are calculated from scratch.
+ *
+ * \param board  the board to check
+ * \throws std::logic_error if the values do not match
+ */
+void verifyIncrementalState(const Board& board)
+{
+  if (board.hash() != Zobrist::compute(board))
+    throw std::logic_error("Incremental Zobrist hash of board does not match the position!");
+  int material = 0;
+  for (int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
+  {
+    material += Material::balance(board.element(static_cast<Field>(i)));
+  }
+  if (board.material() != material)
+    throw std::logic_error("Incremental material balance of board does not match the position!");
+}
+#endif // DEBUG
+
 
 Board::Board()
 : mFields(std::array<Piece, 64>()),
+  mPieceBits(std::array<Bitboard, static_cast<int>(PieceType::none) + 1>()),
+  mColourBits(std::array<Bitboard, static_cast<int>(Colour::black) + 1>()),
   mToMove(Colour::white),
   mEnPassant(Field::none),
   mCastling(Castling()),
   mHalfmoves50(0),
   mBlackInCheck(false),
-  mWhiteInCheck(false)
+  mWhiteInCheck(false),
+  mHash(0),
+  mMaterial(0)
 {
   mFields.fill(Piece());
+  // All fields are empty.
+  mPieceBits.fill(0);
+  mPieceBits[static_cast<int>(PieceType::none)] = ~static_cast<Bitboard>(0);
+  mColourBits.fill(0);
+  mColourBits[static_cast<int>(Colour::none)] = ~static_cast<Bitboard>(0);
+  mHash = Zobrist::compute(*this);
+}
+
+void Board::setField(const Field field, const Piece piece)
+{
+  const Bitboard bit = fieldBit(field);
+  const Piece old = mFields[static_cast<int>(field)];
+  mPieceBits[static_cast<int>(old.piece())] &= ~bit;
+  mColourBits[static_cast<int>(old.colour())] &= ~bit;
+  mPieceBits[static_cast<int>(piece.piece())] |= bit;
+  mColourBits[static_cast<int>(piece.colour())] |= bit;
+  mHash ^= Zobrist::piece(old, field) ^ Zobrist::piece(piece, field);
+  mMaterial += Material::balance(piece) - Material::balance(old);
+  mFields[static_cast<int>(field)] = piece;
 }
 
 const Piece& Board::element(const Field f) const
@@ -93,7 +139,7 @@ bool Board::setElement(const Field field, const Piece& piece)
   if ((field == Field::none) || !piece.acceptable())
     return false;
   // set element
-  mFields[static_cast<int>(field)] = piece;
+  setField(field, piece);
   return true;
 }
 
@@ -102,6 +148,8 @@ bool Board::setToMove(const Colour who)
   if (who == Colour::none)
     return false;
   // set player that is to move
+  if (who != mToMove)
+    mHash ^= Zobrist::blackToMove();
   mToMove = who;
   return true;
 }
@@ -111,6 +159,7 @@ bool Board::setEnPassant(const Field ep)
   // Allowed values are none for "no e.p." or any field on 3rd or 6th row.
   if ((ep == Field::none) || (row(ep) == 3) || (row(ep) == 6))
   {
+    mHash ^= Zobrist::enPassant(mEnPassant) ^ Zobrist::enPassant(ep);
     mEnPassant = ep;
     return true;
   }
@@ -120,6 +169,7 @@ bool Board::setEnPassant(const Field ep)
 
 void Board::setCastling(const Castling& castlingInfo)
 {
+  mHash ^= Zobrist::castling(mCastling) ^ Zobrist::castling(castlingInfo);
   mCastling = castlingInfo;
 }
 
@@ -128,6 +178,11 @@ void Board::setHalfmovesFifty(const unsigned int halfmoves50)
   mHalfmoves50 = halfmoves50;
 }
 
+std::uint64_t Board::hash() const
+{
+  return mHash;
+}
+
 bool Board::isInCheck(const Colour colour) const
 {
   switch(colour)
@@ -184,7 +239,7 @@ bool Board::fromFEN(const std::string& FEN)
       const auto iter = fenmap.find(singleRow[j]);
       if (iter != fenmap.end())
       {
-        mFields[static_cast<int>(toField(boardColumn, boardRow))] = iter->second;
+        setField(toField(boardColumn, boardRow), iter->second);
         boardColumn = nextColumn(boardColumn);
       } // if
       else if ((singleRow[j] >= '1') && (singleRow[j] <= '8'))
@@ -192,7 +247,7 @@ bool Board::fromFEN(const std::string& FEN)
         const auto count = singleRow[j] - '1' + 1;
         for (int k = 1; k <= count; ++k)
         {
-          mFields[static_cast<int>(toField(boardColumn, boardRow))] = Piece(Colour::none, PieceType::none);
+          setField(toField(boardColumn, boardRow), Piece(Colour::none, PieceType::none));
           boardColumn = nextColumn(boardColumn);
         }
       } // else if '1'..'8'
@@ -288,6 +343,9 @@ bool Board::fromFEN(const std::string& FEN)
 
   // update info who is in check
   updateCheckCache();
+  // Side to move, castling and en passant have been set directly, so the
+  // hash has to be calculated from scratch.
+  mHash = Zobrist::compute(*this);
 
   // Other info from FEN is not parsed yet, so return true for now.
   return true;
@@ -313,9 +371,33 @@ bool Board::move(const Field from, const Field to, PieceType promoteTo, const bo
       : true;
   if (!allow)
     return false;
+
+  UndoRecord undo;
+  makeMove(from, to, promoteTo, undo);
+  return true;
+}
+
+void Board::makeMove(const Field from, const Field to, PieceType promoteTo, UndoRecord& undo)
+{
+  const Piece start = element(from);
   // save for possible later use
   const Piece dest = element(to);
 
+  // Save current state for unmakeMove().
+  undo.moved = start;
+  undo.captured = dest;
+  undo.capturedAt = to;
+  undo.castling = mCastling;
+  undo.enPassant = mEnPassant;
+  undo.halfmoves50 = mHalfmoves50;
+  undo.whiteInCheck = mWhiteInCheck;
+  undo.blackInCheck = mBlackInCheck;
+  undo.hash = mHash;
+
+  // Remove castling rights and en passant field from hash, they are added
+  // again after the move.
+  mHash ^= Zobrist::castling(mCastling) ^ Zobrist::enPassant(mEnPassant);
+
   // Handle counter for fifty move rule.
   if ((start.piece() == PieceType::pawn) || (dest.piece() != PieceType::none))
   {
@@ -328,11 +410,10 @@ bool Board::move(const Field from, const Field to, PieceType promoteTo, const bo
     ++mHalfmoves50;
   }
 
-  // Move is allowed.
   // -- "copy" piece to destination field
-  mFields[static_cast<int>(to)] = start;
+  setField(to, start);
   // -- remove piece in start field
-  mFields[static_cast<int>(from)] = Piece(Colour::none, PieceType::none);
+  setField(from, Piece(Colour::none, PieceType::none));
   // holds en passant data for next move
   Field enPassantData = Field::none;
   // -- check for special moves of pawn pieces
@@ -344,12 +425,12 @@ bool Board::move(const Field from, const Field to, PieceType promoteTo, const bo
     // -- check for promotion of white pawn
     if ((start.colour() == Colour::white) && (row(to) == 8))
     {
-      mFields[static_cast<int>(to)] = Piece(Colour::white, promoteTo);
+      setField(to, Piece(Colour::white, promoteTo));
     }
     // -- check for promotion of black pawn
     else if ((start.colour() == Colour::black) && (row(to) == 1))
     {
-       mFields[static_cast<int>(to)] = Piece(Colour::black, promoteTo);
+       setField(to, Piece(Colour::black, promoteTo));
     }
     // check for en passant capture
     else if (to == enPassant())
@@ -364,7 +445,10 @@ bool Board::move(const Field from, const Field to, PieceType promoteTo, const bo
           removeRow = 4;
         else
           removeRow = 5;
-        mFields[static_cast<int>(toField(column(to), removeRow))] = Piece(Colour::none, PieceType::none);
+        const Field removeField = toField(column(to), removeRow);
+        undo.captured = mFields[static_cast<int>(removeField)];
+        undo.capturedAt = removeField;
+        setField(removeField, Piece(Colour::none, PieceType::none));
       } // if
     } // if en passant field is destination
     // check whether en passant capture is possible in next move
@@ -382,16 +466,16 @@ bool Board::move(const Field from, const Field to, PieceType promoteTo, const bo
       {
         // white queenside castling
         // King was already moved, we just have to move the rook here.
-        mFields[static_cast<int>(Field::a1)] = Piece(Colour::none, PieceType::none);
-        mFields[static_cast<int>(Field::d1)] = Piece(Colour::white, PieceType::rook);
+        setField(Field::a1, Piece(Colour::none, PieceType::none));
+        setField(Field::d1, Piece(Colour::white, PieceType::rook));
         mCastling.white_castled = Ternary::true_value;
       }
       if ((to == Field::g1) && (dest.piece() == PieceType::none))
       {
         // white kingside castling
         // King was already moved, we just have to move the rook here.
-        mFields[static_cast<int>(Field::h1)] = Piece(Colour::none, PieceType::none);
-        mFields[static_cast<int>(Field::f1)] = Piece(Colour::white, PieceType::rook);
+        setField(Field::h1, Piece(Colour::none, PieceType::none));
+        setField(Field::f1, Piece(Colour::white, PieceType::rook));
         mCastling.white_castled = Ternary::true_value;
       }
     } // if white king at initial position
@@ -401,16 +485,16 @@ bool Board::move(const Field from, const Field to, PieceType promoteTo, const bo
       {
         // black queenside castling
         // King was already moved, we just have to move the rook here.
-        mFields[static_cast<int>(Field::a8)] = Piece(Colour::none, PieceType::none);
-        mFields[static_cast<int>(Field::d8)] = Piece(Colour::black, PieceType::rook);
+        setField(Field::a8, Piece(Colour::none, PieceType::none));
+        setField(Field::d8, Piece(Colour::black, PieceType::rook));
         mCastling.black_castled = Ternary::true_value;
       }
       if ((to == Field::g8) && (dest.piece() == PieceType::none))
       {
         // black kingside castling
         // King was already moved, we just have to move the rook here.
-        mFields[static_cast<int>(Field::h8)] = Piece(Colour::none, PieceType::none);
-        mFields[static_cast<int>(Field::f8)] = Piece(Colour::black, PieceType::rook);
+        setField(Field::h8, Piece(Colour::none, PieceType::none));
+        setField(Field::f8, Piece(Colour::black, PieceType::rook));
         mCastling.black_castled = Ternary::true_value;
       }
     }// if black king at initial position
@@ -446,6 +530,18 @@ bool Board::move(const Field from, const Field to, PieceType promoteTo, const bo
         mCastling.white_kingside = false;
     } // if white rook moved
   } // if rook
+  // A captured rook can no longer be used for castling, either.
+  if (dest.piece() == PieceType::rook)
+  {
+    if (to == Field::a1)
+      mCastling.white_queenside = false;
+    else if (to == Field::h1)
+      mCastling.white_kingside = false;
+    else if (to == Field::a8)
+      mCastling.black_queenside = false;
+    else if (to == Field::h8)
+      mCastling.black_kingside = false;
+  } // if rook was captured
   // -- update en passant data
   mEnPassant = enPassantData;
   // -- determine whether anyone is in check
@@ -459,7 +555,101 @@ bool Board::move(const Field from, const Field to, PieceType promoteTo, const bo
     mToMove = Colour::black;
   else
     mToMove = Colour::white;
-  return true;
+  mHash ^= Zobrist::castling(mCastling) ^ Zobrist::enPassant(mEnPassant) ^ Zobrist::blackToMove();
+  #ifdef DEBUG
+  verifyIncrementalState(*this);
+  #endif // DEBUG
+}
+
+void Board::unmakeMove(const Field from, const Field to, const UndoRecord& undo)
+{
+  // Put moved piece back to its origin. This also reverts promotions, because
+  // the undo record holds the pawn and not the promoted piece.
+  setField(from, undo.moved);
+  setField(to, Piece(Colour::none, PieceType::none));
+  // Restore captured piece, if any. For en passant captures the field of the
+  // captured pawn is not the destination field of the move.
+  if (undo.captured.piece() != PieceType::none)
+  {
+    setField(undo.capturedAt, undo.captured);
+  }
+  // Move the rook back, if the move was castling. Conditions are the same as
+  // in makeMove().
+  if ((undo.moved.piece() == PieceType::king) && (undo.captured.piece() == PieceType::none))
+  {
+    if ((undo.moved.colour() == Colour::white) && (from == Field::e1))
+    {
+      if (to == Field::c1)
+      {
+        setField(Field::d1, Piece(Colour::none, PieceType::none));
+        setField(Field::a1, Piece(Colour::white, PieceType::rook));
+      }
+      else if (to == Field::g1)
+      {
+        setField(Field::f1, Piece(Colour::none, PieceType::none));
+        setField(Field::h1, Piece(Colour::white, PieceType::rook));
+      }
+    } // if white king at initial position
+    else if ((undo.moved.colour() == Colour::black) && (from == Field::e8))
+    {
+      if (to == Field::c8)
+      {
+        setField(Field::d8, Piece(Colour::none, PieceType::none));
+        setField(Field::a8, Piece(Colour::black, PieceType::rook));
+      }
+      else if (to == Field::g8)
+      {
+        setField(Field::f8, Piece(Colour::none, PieceType::none));
+        setField(Field::h8, Piece(Colour::black, PieceType::rook));
+      }
+    } // if black king at initial position
+  } // if king may have been castling
+  // Restore remaining state.
+  mToMove = undo.moved.colour();
+  mCastling = undo.castling;
+  mEnPassant = undo.enPassant;
+  mHalfmoves50 = undo.halfmoves50;
+  mWhiteInCheck = undo.whiteInCheck;
+  mBlackInCheck = undo.blackInCheck;
+  mHash = undo.hash;
+  #ifdef DEBUG
+  verifyIncrementalState(*this);
+  #endif // DEBUG
+}
+
+void Board::makeNullMove(UndoRecord& undo)
+{
+  undo.moved = Piece(mToMove, PieceType::none);
+  undo.captured = Piece(Colour::none, PieceType::none);
+  undo.capturedAt = Field::none;
+  undo.castling = mCastling;
+  undo.enPassant = mEnPassant;
+  undo.halfmoves50 = mHalfmoves50;
+  undo.whiteInCheck = mWhiteInCheck;
+  undo.blackInCheck = mBlackInCheck;
+  undo.hash = mHash;
+
+  // No piece moves, so only the en passant field (which is gone after any
+  // move) and the player to move change. Check states stay the same.
+  mHash ^= Zobrist::enPassant(mEnPassant) ^ Zobrist::blackToMove();
+  mEnPassant = Field::none;
+  mHash ^= Zobrist::enPassant(mEnPassant);
+  ++mHalfmoves50;
+  mToMove = (mToMove == Colour::white) ? Colour::black : Colour::white;
+  #ifdef DEBUG
+  verifyIncrementalState(*this);
+  #endif // DEBUG
+}
+
+void Board::unmakeNullMove(const UndoRecord& undo)
+{
+  mToMove = undo.moved.colour();
+  mEnPassant = undo.enPassant;
+  mHalfmoves50 = undo.halfmoves50;
+  mHash = undo.hash;
+  #ifdef DEBUG
+  verifyIncrementalState(*this);
+  #endif // DEBUG
 }
 
 Field Board::findNext(const Piece& piece, Field start) const
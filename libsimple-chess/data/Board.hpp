@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2016, 2017, 2018, 2021  Dirk Stolle
+    Copyright (C) 2016, 2017, 2018, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,9 +22,12 @@
 #define SIMPLE_CHESS_BOARD_HPP
 
 #include <array>
+#include <cstdint>
+#include "Bitboard.hpp"
 #include "Castling.hpp"
 #include "Field.hpp"
 #include "Piece.hpp"
+#include "UndoRecord.hpp"
 
 namespace simplechess
 {
@@ -45,6 +48,51 @@ class Board
     const Piece& element(const Field f) const;
 
 
+    /** \brief Gets the fields occupied by pieces of a certain type.
+     *
+     * \param type  the type of piece; none gets all empty fields
+     * \return Returns a bitboard of all fields with pieces of the given type,
+     *         no matter which colour they have.
+     */
+    Bitboard pieces(const PieceType type) const
+    {
+      return mPieceBits[static_cast<int>(type)];
+    }
+
+
+    /** \brief Gets the fields occupied by pieces of a certain colour.
+     *
+     * \param colour  the colour of the pieces; none gets all empty fields
+     * \return Returns a bitboard of all fields with pieces of the given colour.
+     */
+    Bitboard pieces(const Colour colour) const
+    {
+      return mColourBits[static_cast<int>(colour)];
+    }
+
+
+    /** \brief Gets the fields occupied by a certain piece.
+     *
+     * \param colour  the colour of the piece
+     * \param type    the type of the piece
+     * \return Returns a bitboard of all fields with the given piece.
+     */
+    Bitboard pieces(const Colour colour, const PieceType type) const
+    {
+      return mColourBits[static_cast<int>(colour)] & mPieceBits[static_cast<int>(type)];
+    }
+
+
+    /** \brief Gets all fields that are occupied by any piece.
+     *
+     * \return Returns a bitboard of all non-empty fields.
+     */
+    Bitboard occupied() const
+    {
+      return ~mColourBits[static_cast<int>(Colour::none)];
+    }
+
+
     /** \brief Gets the player / colour who is to move next.
      *
      * \return Returns the player / colour who is to move next.
@@ -123,6 +171,39 @@ class Board
     void setHalfmovesFifty(const unsigned int halfmoves50);
 
 
+    /** \brief Gets the Zobrist hash of the position.
+     *
+     * \return Returns the 64 bit Zobrist hash of the position. It covers the
+     *         pieces, the side to move, the castling rights and the en passant
+     *         file, and it is updated incrementally during moves.
+     */
+    std::uint64_t hash() const;
+
+
+    /** \brief Gets the material balance of the position.
+     *
+     * \return Returns the sum of the material values of all white pieces
+     *         minus the sum of the material values of all black pieces in
+     *         centipawns. The value is updated incrementally during moves.
+     */
+    int material() const
+    {
+      return mMaterial;
+    }
+
+
+    /** \brief Gets the number of pieces of a certain kind on the board.
+     *
+     * \param colour  the colour of the pieces
+     * \param type    the type of the pieces
+     * \return Returns the number of pieces with the given colour and type.
+     */
+    int pieceCount(const Colour colour, const PieceType type) const
+    {
+      return popCount(pieces(colour, type));
+    }
+
+
     /** \brief Determines whether one side is currently in check.
      *
      * \param colour   the colour that is (or is not) in check
@@ -163,6 +244,51 @@ class Board
     bool move(const Field from, const Field to, PieceType promoteTo, const bool onlyAllowed = true);
 
 
+    /** \brief Performs a move on the board without checking whether it is allowed.
+     *
+     * \param from       field where the move starts
+     * \param to         field where the move ends
+     * \param promoteTo  type of piece that a pawn shall be promoted to,
+                         if the move allows pawn promotion
+     * \param undo       record that receives the information required to take
+     *                   back the move via unmakeMove()
+     * \remarks The caller has to make sure that the move is allowed and that
+     *          the piece on the origin field belongs to the player who is to
+     *          move. Unlike a copy of the board, the undo record is small, so
+     *          this is the preferred way to walk through positions in a search.
+     */
+    void makeMove(const Field from, const Field to, PieceType promoteTo, UndoRecord& undo);
+
+
+    /** \brief Takes back a move that was performed via makeMove().
+     *
+     * \param from  field where the move started
+     * \param to    field where the move ended
+     * \param undo  the undo record that was filled by makeMove()
+     * \remarks Moves have to be taken back in reverse order of their execution.
+     */
+    void unmakeMove(const Field from, const Field to, const UndoRecord& undo);
+
+
+    /** \brief Passes the turn to the other player without moving a piece.
+     *
+     * \param undo  record that receives the information required to take
+     *              back the null move via unmakeNullMove()
+     * \remarks This is no legal move in chess. It is only used by the search
+     *          to find out whether a position is still good for the player to
+     *          move, if the opponent could move twice in a row.
+     *          The player to move must not be in check.
+     */
+    void makeNullMove(UndoRecord& undo);
+
+
+    /** \brief Takes back a null move that was performed via makeNullMove().
+     *
+     * \param undo  the undo record that was filled by makeNullMove()
+     */
+    void unmakeNullMove(const UndoRecord& undo);
+
+
     /** \brief Finds the next field where a certain piece is located.
      *
      * \param piece piece for which to search
@@ -172,13 +298,24 @@ class Board
      */
     Field findNext(const Piece& piece, Field start) const;
   private:
+    /** \brief Sets a piece on a field and updates the bitboards accordingly.
+     *
+     * \param field  the field, must not be none
+     * \param piece  the new piece on that field
+     */
+    void setField(const Field field, const Piece piece);
+
     std::array<Piece, static_cast<int>(Field::none)> mFields; /**< pieces on fields of the board */
+    std::array<Bitboard, static_cast<int>(PieceType::none) + 1> mPieceBits; /**< occupied fields per piece type, index is the piece type */
+    std::array<Bitboard, static_cast<int>(Colour::black) + 1> mColourBits; /**< occupied fields per colour, index is the colour */
     Colour mToMove; /**< player/colour that is to move next */
     Field  mEnPassant; /**< en passant field, if any */
     Castling mCastling; /**< castling information (i.e. where is castling still allowed) */
     unsigned int mHalfmoves50; /**< number of half moves under the 50 move rule */
     bool mBlackInCheck; /**< whether black player is in check */
     bool mWhiteInCheck; /**< whether white player is in check */
+    std::uint64_t mHash; /**< Zobrist hash of the position */
+    int mMaterial; /**< material balance of the position in centipawns, positive values favour white */
 }; // class
 
 } // namespace
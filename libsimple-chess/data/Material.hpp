@@ -0,0 +1,91 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_MATERIAL_HPP
+#define SIMPLE_CHESS_MATERIAL_HPP
+
+#include "Piece.hpp"
+
+namespace simplechess
+{
+
+/** \brief Provides the material values of the pieces.
+ *
+ * \remarks The board keeps the material balance of all its pieces up to date
+ *          during moves, so evaluations can get it without looking at each
+ *          field of the board.
+ */
+class Material
+{
+  public:
+    /** \brief Gets the material value of a piece type in centipawns.
+     *
+     * \param pt  piece type that shall be evaluated
+     * \return Returns the value of a piece in centipawns.
+     */
+    static constexpr int value(const PieceType pt)
+    {
+      switch (pt)
+      {
+        case PieceType::pawn:
+             return 100;
+        case PieceType::bishop:
+             return 325;
+        case PieceType::knight:
+             return 300;
+        case PieceType::rook:
+             return 500;
+        case PieceType::queen:
+             return 900;
+        // Value of king is higher than all other pieces combined, because if
+        // you loose the king you loose the game.
+        case PieceType::king:
+             return 1000000;
+        case PieceType::none:
+        default:
+             return 0;
+      }
+    }
+
+
+    /** \brief Gets the contribution of a piece to the material balance.
+     *
+     * \param piece  the piece
+     * \return Returns the value of the piece in centipawns for white pieces,
+     *         the negative value for black pieces and zero for empty pieces.
+     */
+    static constexpr int balance(const Piece piece)
+    {
+      switch (piece.colour())
+      {
+        case Colour::white:
+             return value(piece.piece());
+        case Colour::black:
+             return -value(piece.piece());
+        case Colour::none:
+        default:
+             return 0;
+      }
+    }
+}; // class
+
+} // namespace
+
+#endif // SIMPLE_CHESS_MATERIAL_HPP
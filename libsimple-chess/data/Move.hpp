@@ -0,0 +1,86 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_MOVE_HPP
+#define SIMPLE_CHESS_MOVE_HPP
+
+#include "Field.hpp"
+#include "Piece.hpp"
+
+namespace simplechess
+{
+
+/** \brief structure that represents a single move on the board */
+struct Move
+{
+  Field from; /**< field where the move starts */
+  Field to; /**< field where the move ends */
+  PieceType promoteTo; /**< type of piece a pawn is promoted to, or none if the move is no promotion */
+
+  /** \brief Constructs an empty move. */
+  constexpr Move()
+  : from(Field::none), to(Field::none), promoteTo(PieceType::none)
+  {
+  }
+
+  /** \brief Parameterized constructor.
+   *
+   * \param origin       field where the move starts
+   * \param destination  field where the move ends
+   * \param promotion    type of piece a pawn is promoted to, if the move is a
+   *                     pawn promotion; none otherwise
+   */
+  constexpr Move(const Field origin, const Field destination, const PieceType promotion = PieceType::none)
+  : from(origin), to(destination), promoteTo(promotion)
+  {
+  }
+
+  /** \brief Checks whether the move is a pawn promotion.
+   *
+   * \return Returns true, if the move is a pawn promotion.
+   */
+  constexpr bool isPromotion() const
+  {
+    return promoteTo != PieceType::none;
+  }
+
+  /** \brief Checks whether the move is empty, i.e. not set.
+   *
+   * \return Returns true, if the move is empty.
+   */
+  constexpr bool empty() const
+  {
+    return from == Field::none;
+  }
+
+  constexpr bool operator==(const Move& other) const
+  {
+    return (from == other.from) && (to == other.to) && (promoteTo == other.promoteTo);
+  }
+
+  constexpr bool operator!=(const Move& other) const
+  {
+    return !(*this == other);
+  }
+}; // struct
+
+} // namespace
+
+#endif // SIMPLE_CHESS_MOVE_HPP
@@ -0,0 +1,146 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_MOVELIST_HPP
+#define SIMPLE_CHESS_MOVELIST_HPP
+
+#include <array>
+#include <cstddef>
+#include "Move.hpp"
+
+namespace simplechess
+{
+
+/** \brief Fixed-capacity list of moves.
+ *
+ * \remarks The list does not allocate any memory on the heap, so it can be put
+ *          on the stack in every node of a search without any noticeable cost.
+ *          No legal chess position has more than 218 moves, so the capacity of
+ *          256 entries is always sufficient.
+ */
+class MoveList
+{
+  public:
+    /** maximum number of moves in the list */
+    static constexpr std::size_t capacity = 256;
+
+    typedef std::array<Move, capacity>::iterator iterator;
+    typedef std::array<Move, capacity>::const_iterator const_iterator;
+
+
+    /** \brief Constructs an empty list. */
+    MoveList()
+    : mSize(0)
+    {
+    }
+
+
+    /** \brief Adds a move to the end of the list.
+     *
+     * \param move  the move to add
+     * \remarks The list must not be full yet.
+     */
+    void add(const Move& move)
+    {
+      mMoves[mSize] = move;
+      ++mSize;
+    }
+
+
+    /** \brief Removes all moves from the list. */
+    void clear()
+    {
+      mSize = 0;
+    }
+
+
+    /** \brief Removes all moves after the given number of moves.
+     *
+     * \param newSize  number of moves to keep, must not be more than size()
+     */
+    void truncate(const std::size_t newSize)
+    {
+      mSize = newSize;
+    }
+
+
+    /** \brief Gets the number of moves in the list.
+     *
+     * \return Returns the number of moves in the list.
+     */
+    std::size_t size() const
+    {
+      return mSize;
+    }
+
+
+    /** \brief Checks whether the list is empty.
+     *
+     * \return Returns true, if the list contains no moves.
+     */
+    bool empty() const
+    {
+      return mSize == 0;
+    }
+
+
+    /** \brief Gets the move at the given index.
+     *
+     * \param idx  zero-based index, must be less than size()
+     * \return Returns the move at the given index.
+     */
+    Move& operator[](const std::size_t idx)
+    {
+      return mMoves[idx];
+    }
+
+    const Move& operator[](const std::size_t idx) const
+    {
+      return mMoves[idx];
+    }
+
+
+    iterator begin()
+    {
+      return mMoves.begin();
+    }
+
+    iterator end()
+    {
+      return mMoves.begin() + mSize;
+    }
+
+    const_iterator begin() const
+    {
+      return mMoves.begin();
+    }
+
+    const_iterator end() const
+    {
+      return mMoves.begin() + mSize;
+    }
+  private:
+    std::array<Move, capacity> mMoves; /**< storage for moves */
+    std::size_t mSize; /**< number of moves in the list */
+}; // class
+
+} // namespace
+
+#endif // SIMPLE_CHESS_MOVELIST_HPP
@@ -0,0 +1,50 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_UNDORECORD_HPP
+#define SIMPLE_CHESS_UNDORECORD_HPP
+
+#include <cstdint>
+#include "Castling.hpp"
+#include "Field.hpp"
+#include "Piece.hpp"
+
+namespace simplechess
+{
+
+/** \brief Holds the information that is required to take back a move that was
+           performed by Board::makeMove().
+ */
+struct UndoRecord
+{
+  Piece moved; /**< piece that was moved, i.e. the pawn in case of a promotion */
+  Piece captured; /**< piece that was captured, or an empty piece if there was no capture */
+  Field capturedAt; /**< field of the captured piece (differs from the destination for en passant captures) */
+  Castling castling; /**< castling information before the move */
+  Field enPassant; /**< en passant field before the move */
+  unsigned int halfmoves50; /**< number of half moves under the 50 move rule before the move */
+  bool whiteInCheck; /**< whether white was in check before the move */
+  bool blackInCheck; /**< whether black was in check before the move */
+  std::uint64_t hash; /**< Zobrist hash of the position before the move */
+}; // struct
+
+} // namespace
+
+#endif // SIMPLE_CHESS_UNDORECORD_HPP
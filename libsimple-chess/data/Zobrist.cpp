@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017  Dirk Stolle
+    Copyright (C) 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -18,40 +18,24 @@
  -------------------------------------------------------------------------------
 */
 
-#include "Node.hpp"
-#include <algorithm>
+#include "Zobrist.hpp"
+#include "Board.hpp"
 
 namespace simplechess
 {
 
-Node::Node()
-: board(Board()),
-  origin(Field::none),
-  destination(Field::none),
-  promoteTo(PieceType::none),
-  score(0),
-  children(std::vector<std::unique_ptr<Node>>())
+std::uint64_t Zobrist::compute(const Board& board)
 {
+  std::uint64_t hash = 0;
+  for (int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
+  {
+    hash ^= piece(board.element(static_cast<Field>(i)), static_cast<Field>(i));
+  }
+  if (board.toMove() == Colour::black)
+    hash ^= blackToMove();
+  hash ^= castling(board.castling());
+  hash ^= enPassant(board.enPassant());
+  return hash;
 }
 
-Node::Node(const Board& b, const Field& orig, const Field& dest, const PieceType& promo, const int _score)
-: board(b),
-  origin(orig),
-  destination(dest),
-  promoteTo(promo),
-  score(_score),
-  children(std::vector<std::unique_ptr<Node>>())
-{
-}
-
-bool lessNode(const std::unique_ptr<Node>& a, const std::unique_ptr<Node>& b)
-{
-  return a->score < b->score;
-}
-
-void Node::sortChildren()
-{
-  std::sort(children.begin(), children.end(), lessNode);
-}
-
-} //namespace
+} // namespace
@@ -0,0 +1,146 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_ZOBRIST_HPP
+#define SIMPLE_CHESS_ZOBRIST_HPP
+
+#include <array>
+#include <cstdint>
+#include "Castling.hpp"
+#include "Field.hpp"
+#include "Piece.hpp"
+
+namespace simplechess
+{
+
+// forward declaration
+class Board;
+
+namespace detail
+{
+  /** number of keys: pieces of two colours and six types on 64 fields, one
+      key for the side to move, four castling rights and eight files for en
+      passant */
+  constexpr int zobristKeyCount = 2 * 6 * 64 + 1 + 4 + 8;
+
+  /** \brief Generates the keys with the splitmix64 generator.
+   *
+   * \return Returns an array of pseudo-random keys.
+   */
+  constexpr std::array<std::uint64_t, zobristKeyCount> generateZobristKeys()
+  {
+    std::array<std::uint64_t, zobristKeyCount> result{};
+    std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (auto& key : result)
+    {
+      state += 0x9E3779B97F4A7C15ULL;
+      std::uint64_t z = state;
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      key = z ^ (z >> 31);
+    }
+    return result;
+  }
+} // namespace detail
+
+/** \brief Provides the random keys for Zobrist hashing of board positions.
+ *
+ * \remarks The hash of a position is the XOR of the keys of all pieces on
+ *          their fields, the key for black to move (if black is to move), the
+ *          keys of all castling rights that are still available and the key
+ *          of the en passant file (if any). Since XOR is its own inverse, the
+ *          hash can be updated incrementally during a move.
+ */
+class Zobrist
+{
+  public:
+    /** \brief Gets the key of a piece on a field.
+     *
+     * \param piece  the piece; empty pieces have a zero key
+     * \param f      the field, must not be none
+     * \return Returns the key of the piece on the given field.
+     */
+    static constexpr std::uint64_t piece(const Piece piece, const Field f)
+    {
+      if (piece.colour() == Colour::none)
+        return 0;
+      return keys[(static_cast<int>(piece.colour()) - 1) * 6 * 64
+                  + static_cast<int>(piece.piece()) * 64 + static_cast<int>(f)];
+    }
+
+
+    /** \brief Gets the key that is used when black is to move.
+     *
+     * \return Returns the key for black to move.
+     */
+    static constexpr std::uint64_t blackToMove()
+    {
+      return keys[sideIndex];
+    }
+
+
+    /** \brief Gets the combined key of the available castling rights.
+     *
+     * \param castling  the castling information
+     * \return Returns the XOR of the keys of all castling rights that are
+     *         still available. Whether a player has already castled does not
+     *         change the key.
+     */
+    static constexpr std::uint64_t castling(const Castling& castling)
+    {
+      return (castling.white_kingside ? keys[castlingIndex] : 0)
+          ^ (castling.white_queenside ? keys[castlingIndex + 1] : 0)
+          ^ (castling.black_kingside ? keys[castlingIndex + 2] : 0)
+          ^ (castling.black_queenside ? keys[castlingIndex + 3] : 0);
+    }
+
+
+    /** \brief Gets the key of an en passant field.
+     *
+     * \param ep  the en passant field, or none if there is none
+     * \return Returns the key of the file of the en passant field.
+     *         Returns zero, if the field is none.
+     */
+    static constexpr std::uint64_t enPassant(const Field ep)
+    {
+      if (ep == Field::none)
+        return 0;
+      return keys[enPassantIndex + static_cast<int>(ep) / 8];
+    }
+
+
+    /** \brief Calculates the hash of a board from scratch.
+     *
+     * \param board  the board
+     * \return Returns the Zobrist hash of the board.
+     */
+    static std::uint64_t compute(const Board& board);
+  private:
+    static constexpr int sideIndex = 2 * 6 * 64; /**< index of the key for black to move */
+    static constexpr int castlingIndex = sideIndex + 1; /**< index of the first castling key */
+    static constexpr int enPassantIndex = castlingIndex + 4; /**< index of the key for en passant on file a */
+    static_assert(enPassantIndex + 8 == detail::zobristKeyCount, "Number of Zobrist keys does not match!");
+
+    static constexpr std::array<std::uint64_t, detail::zobristKeyCount> keys = detail::generateZobristKeys(); /**< all keys */
+}; // class
+
+} // namespace
+
+#endif // SIMPLE_CHESS_ZOBRIST_HPP
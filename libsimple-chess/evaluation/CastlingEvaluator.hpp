@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2018, 2020, 2022  Dirk Stolle
+    Copyright (C) 2018, 2020, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -52,6 +52,10 @@ class CastlingEvaluator: public Evaluator
     int score(const Board& board) const override;
 
 
+    // Castling state is read directly from the board.
+    using Evaluator::score;
+
+
     /** \brief Gets the name of the evaluator.
      *
      * \return Returns the name of the evaluator.
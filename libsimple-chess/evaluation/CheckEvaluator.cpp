@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2020  Dirk Stolle
+    Copyright (C) 2017, 2020, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,7 +20,6 @@
 
 #include "CheckEvaluator.hpp"
 #include "MaterialEvaluator.hpp"
-#include "../rules/check.hpp"
 
 namespace simplechess
 {
@@ -35,16 +34,27 @@ CheckEvaluator::CheckEvaluator(const int checkValue, const int checkmateValue)
 }
 
 int CheckEvaluator::score(const Board& board) const
+{
+  return score(board, EvaluationContext(board));
+}
+
+int CheckEvaluator::score([[maybe_unused]] const Board& board, const EvaluationContext& context) const
 {
   int result = 0;
-  if (board.isInCheck(Colour::white))
+  // Only a player in check can be checkmate, so the (comparatively costly)
+  // test for checkmate is only done for players in check.
+  if (context.inCheck(Colour::white))
+  {
     result -= mCheckValue;
-  if (isCheckMate(board, Colour::white))
-    result -= mCheckmateValue;
-  if (board.isInCheck(Colour::black))
+    if (context.isCheckMate(Colour::white))
+      result -= mCheckmateValue;
+  }
+  if (context.inCheck(Colour::black))
+  {
     result += mCheckValue;
-  if (isCheckMate(board, Colour::black))
-    result += mCheckmateValue;
+    if (context.isCheckMate(Colour::black))
+      result += mCheckmateValue;
+  }
 
   return result;
 }
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2018, 2024, 2025  Dirk Stolle
+    Copyright (C) 2018, 2024, 2025, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,6 +19,7 @@
 */
 
 #include "CompoundCreator.hpp"
+#include <initializer_list>
 #include <unordered_set>
 #include "CastlingEvaluator.hpp"
 #include "CheckEvaluator.hpp"
@@ -26,11 +27,53 @@
 #include "MaterialEvaluator.hpp"
 #include "PromotionEvaluator.hpp"
 #include "RootMobilityEvaluator.hpp"
+#include "StaticCompound.hpp"
 #include "../../util/strings.hpp"
 
 namespace simplechess
 {
 
+/** \brief Checks whether a set of evaluator ids contains exactly the given ids.
+ *
+ * \param ids       set of evaluator ids
+ * \param expected  the expected ids
+ * \return Returns true, if both contain the same ids.
+ */
+bool hasIds(const std::unordered_set<std::string>& ids, const std::initializer_list<std::string_view> expected)
+{
+  if (ids.size() != expected.size())
+    return false;
+  for (const std::string_view id : expected)
+  {
+    if (ids.find(std::string(id)) == ids.end())
+      return false;
+  }
+  return true;
+}
+
+/** \brief Gets a statically composed evaluator for a combination of evaluator ids.
+ *
+ * \param ids  set of evaluator ids
+ * \return Returns a StaticCompound of the evaluators, if it is one of the
+ *         combinations that are commonly used.
+ *         Returns nullptr for all other combinations.
+ */
+std::unique_ptr<Evaluator> staticCompound(const std::unordered_set<std::string>& ids)
+{
+  using CC = CompoundCreator;
+  if (hasIds(ids, { CC::IdMaterial, CC::IdLinearMobility, CC::IdPromotion, CC::IdCheck, CC::IdCastling }))
+    return std::unique_ptr<Evaluator>(new StaticCompound<MaterialEvaluator, LinearMobilityEvaluator, PromotionEvaluator, CheckEvaluator, CastlingEvaluator>());
+  if (hasIds(ids, { CC::IdMaterial, CC::IdRootMobility, CC::IdPromotion, CC::IdCheck, CC::IdCastling }))
+    return std::unique_ptr<Evaluator>(new StaticCompound<MaterialEvaluator, RootMobilityEvaluator, PromotionEvaluator, CheckEvaluator, CastlingEvaluator>());
+  if (hasIds(ids, { CC::IdMaterial, CC::IdLinearMobility }))
+    return std::unique_ptr<Evaluator>(new StaticCompound<MaterialEvaluator, LinearMobilityEvaluator>());
+  if (hasIds(ids, { CC::IdMaterial, CC::IdRootMobility }))
+    return std::unique_ptr<Evaluator>(new StaticCompound<MaterialEvaluator, RootMobilityEvaluator>());
+  if (hasIds(ids, { CC::IdMaterial }))
+    return std::unique_ptr<Evaluator>(new StaticCompound<MaterialEvaluator>());
+  return nullptr;
+}
+
 bool CompoundCreator::create(const std::string_view evaluators, CompoundEvaluator& compound)
 {
   if (evaluators.empty())
@@ -78,6 +121,9 @@ bool CompoundCreator::create(const std::string_view evaluators, CompoundEvaluato
       return false;
     }
   } // for
+  // Commonly used combinations of evaluators are available as StaticCompound,
+  // which saves the virtual calls of the single evaluators.
+  compound.setFused(staticCompound(ids));
   // Success - unless compound is empty.
   return !compound.empty();
 }
@@ -91,6 +137,8 @@ void CompoundCreator::getDefault(CompoundEvaluator& compound)
   compound.add(std::unique_ptr<Evaluator>(new PromotionEvaluator()));
   compound.add(std::unique_ptr<Evaluator>(new CheckEvaluator()));
   compound.add(std::unique_ptr<Evaluator>(new CastlingEvaluator()));
+  compound.setFused(std::unique_ptr<Evaluator>(new StaticCompound<MaterialEvaluator,
+      LinearMobilityEvaluator, PromotionEvaluator, CheckEvaluator, CastlingEvaluator>()));
 }
 
 } // namespace
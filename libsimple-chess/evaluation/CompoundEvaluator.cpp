@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2018, 2020  Dirk Stolle
+    Copyright (C) 2017, 2018, 2020, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -24,21 +24,43 @@ namespace simplechess
 {
 
 CompoundEvaluator::CompoundEvaluator()
-: evaluators(std::vector<std::unique_ptr<Evaluator>>())
+: evaluators(std::vector<std::unique_ptr<Evaluator>>()),
+  fusedEvaluator(nullptr)
 {
 }
 
 void CompoundEvaluator::add(std::unique_ptr<Evaluator>&& eval)
 {
   evaluators.push_back(std::move(eval));
+  fusedEvaluator.reset();
+}
+
+void CompoundEvaluator::setFused(std::unique_ptr<Evaluator>&& fused)
+{
+  fusedEvaluator = std::move(fused);
+}
+
+bool CompoundEvaluator::isFused() const noexcept
+{
+  return fusedEvaluator != nullptr;
 }
 
 int CompoundEvaluator::score(const Board& board) const
 {
+  // The context is only built once per position, so that all evaluators can
+  // share the facts about the position that they need.
+  return score(board, EvaluationContext(board));
+}
+
+int CompoundEvaluator::score(const Board& board, const EvaluationContext& context) const
+{
+  if (fusedEvaluator != nullptr)
+    return fusedEvaluator->score(board, context);
+
   int sum = 0;
   for (const auto & evaluator : evaluators)
   {
-    sum += evaluator->score(board);
+    sum += evaluator->score(board, context);
   }
   return sum;
 }
@@ -51,6 +73,7 @@ std::size_t CompoundEvaluator::size() const noexcept
 void CompoundEvaluator::clear() noexcept
 {
   evaluators.clear();
+  fusedEvaluator.reset();
 }
 
 bool CompoundEvaluator::empty() const noexcept
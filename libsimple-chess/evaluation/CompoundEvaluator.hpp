@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2018, 2020, 2022  Dirk Stolle
+    Copyright (C) 2017, 2018, 2020, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -48,6 +48,16 @@ class CompoundEvaluator: public Evaluator
     int score(const Board& board) const override;
 
 
+    /** \brief Evaluates the current situation on the board, using facts about
+     *         the position that have already been determined.
+     *
+     * \param board    the board that shall be evaluated
+     * \param context  the evaluation context of the same board
+     * \return Returns the evaluation of the board in centipawns.
+     */
+    int score(const Board& board, const EvaluationContext& context) const override;
+
+
     /** \brief Gets the name of the evaluator.
      *
      * \return Returns the name of the evaluator.
@@ -63,6 +73,27 @@ class CompoundEvaluator: public Evaluator
     void add(std::unique_ptr<Evaluator>&& eval);
 
 
+    /** \brief Sets an evaluator that calculates the sum of all evaluators of
+     *         the compound in a single call.
+     *
+     * \param fused  evaluator that gives the same score as the sum of all
+     *               evaluators that have been added so far, usually a
+     *               StaticCompound of the same evaluator types
+     * \remarks score() uses the fused evaluator instead of the single
+     *          evaluators, which avoids a virtual call per evaluator. Adding
+     *          another evaluator or clearing the compound drops the fused
+     *          evaluator.
+     */
+    void setFused(std::unique_ptr<Evaluator>&& fused);
+
+
+    /** \brief Checks whether the compound has a fused evaluator.
+     *
+     * \return true if score() uses a fused evaluator, false otherwise
+     */
+    bool isFused() const noexcept;
+
+
     /** \brief Gets the size of the compound, i.e. the number of evaluators in it.
      *
      * \return compound size
@@ -82,6 +113,7 @@ class CompoundEvaluator: public Evaluator
     bool empty() const noexcept;
   private:
     std::vector<std::unique_ptr<Evaluator>> evaluators; /**< vector of evaluators to sum up */
+    std::unique_ptr<Evaluator> fusedEvaluator; /**< evaluator that calculates the whole sum at once, may be null */
 }; // class
 
 } // namespace
@@ -0,0 +1,131 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "EvaluationContext.hpp"
+#include "../rules/attacks.hpp"
+#include "../rules/Moves.hpp"
+
+namespace simplechess
+{
+
+EvaluationContext::EvaluationContext(const Board& board)
+: mBoard(board),
+  mHasKings(false),
+  mKings({ Field::none, Field::none, Field::none }),
+  mKingZones({ 0, 0, 0 }),
+  mAttacks({ 0, 0, 0 }),
+  mHasAttacks({ false, false, false }),
+  mMoveCounts({ -1, -1, -1 })
+{
+}
+
+void EvaluationContext::determineKings() const
+{
+  for (const Colour colour : { Colour::white, Colour::black })
+  {
+    const Bitboard kings = mBoard.pieces(colour, PieceType::king);
+    if (kings == 0)
+      continue;
+    const Field king = firstField(kings);
+    mKings[static_cast<int>(colour)] = king;
+    mKingZones[static_cast<int>(colour)] = kingAttacks(king) | fieldBit(king);
+  } // for
+  mHasKings = true;
+}
+
+Field EvaluationContext::king(const Colour colour) const
+{
+  if (!mHasKings)
+    determineKings();
+  return mKings[static_cast<int>(colour)];
+}
+
+Bitboard EvaluationContext::kingZone(const Colour colour) const
+{
+  if (!mHasKings)
+    determineKings();
+  return mKingZones[static_cast<int>(colour)];
+}
+
+Bitboard EvaluationContext::attacks(const Colour colour) const
+{
+  const int idx = static_cast<int>(colour);
+  if (mHasAttacks[idx])
+    return mAttacks[idx];
+
+  const Bitboard occupied = mBoard.occupied();
+  Bitboard result = 0;
+  Bitboard pieces = mBoard.pieces(colour);
+  while (pieces != 0)
+  {
+    const Field from = popFirstField(pieces);
+    switch (mBoard.element(from).piece())
+    {
+      case PieceType::pawn:
+           result |= pawnAttacks(colour, from);
+           break;
+      case PieceType::knight:
+           result |= knightAttacks(from);
+           break;
+      case PieceType::bishop:
+           result |= bishopAttacks(from, occupied);
+           break;
+      case PieceType::rook:
+           result |= rookAttacks(from, occupied);
+           break;
+      case PieceType::queen:
+           result |= queenAttacks(from, occupied);
+           break;
+      case PieceType::king:
+           result |= kingAttacks(from);
+           break;
+      case PieceType::none:
+           // Colour matches the player, so this will never happen.
+           break;
+    } // switch
+  } // while
+  mAttacks[idx] = result;
+  mHasAttacks[idx] = true;
+  return result;
+}
+
+int EvaluationContext::moveCount(const Colour colour) const
+{
+  const int idx = static_cast<int>(colour);
+  if (mMoveCounts[idx] < 0)
+    mMoveCounts[idx] = Moves::count(mBoard, colour);
+  return mMoveCounts[idx];
+}
+
+bool EvaluationContext::isCheckMate(const Colour colour) const
+{
+  // Same conditions as in isCheckMate(): only the player who is to move and
+  // who is in check can be checkmate.
+  if (!mBoard.isInCheck(colour) || (mBoard.toMove() != colour))
+    return false;
+  // If the moves have already been counted, e.g. by a mobility evaluator,
+  // then use that number. Otherwise the first allowed move is enough.
+  const int idx = static_cast<int>(colour);
+  if (mMoveCounts[idx] >= 0)
+    return mMoveCounts[idx] == 0;
+  return !Moves::hasAllowedMove(mBoard, colour);
+}
+
+} // namespace
@@ -0,0 +1,131 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_EVALUATIONCONTEXT_HPP
+#define SIMPLE_CHESS_EVALUATIONCONTEXT_HPP
+
+#include <array>
+#include "../data/Bitboard.hpp"
+#include "../data/Board.hpp"
+
+namespace simplechess
+{
+
+/** \brief Holds facts about a position that several evaluators need, so that
+ *         they are only determined once per evaluation of the position.
+ *
+ * \remarks The context is created for one board and must not outlive it.
+ *          All facts are determined on first use and then kept for all later
+ *          evaluators, so creating a context costs next to nothing. The pieces themselves are not
+ *          repeated here, because the bitboards of the board already serve as
+ *          piece lists, see Board::pieces().
+ */
+class EvaluationContext
+{
+  public:
+    /** \brief Creates the context for a board.
+     *
+     * \param board  the board that shall be evaluated
+     */
+    explicit EvaluationContext(const Board& board);
+
+
+    /** \brief Gets the board of the context.
+     *
+     * \return Returns the board that is evaluated.
+     */
+    const Board& board() const noexcept
+    {
+      return mBoard;
+    }
+
+
+    /** \brief Gets the field of a player's king.
+     *
+     * \param colour  the colour of the player, must not be none
+     * \return Returns the field of the king.
+     *         Returns Field::none, if the player has no king.
+     */
+    Field king(const Colour colour) const;
+
+
+    /** \brief Gets the fields around a player's king, including the field
+     *         of the king itself.
+     *
+     * \param colour  the colour of the player, must not be none
+     * \return Returns the king zone. Returns zero, if the player has no king.
+     */
+    Bitboard kingZone(const Colour colour) const;
+
+
+    /** \brief Checks whether a player is in check.
+     *
+     * \param colour  the colour of the player
+     * \return Returns true, if the player is in check.
+     */
+    bool inCheck(const Colour colour) const
+    {
+      return mBoard.isInCheck(colour);
+    }
+
+
+    /** \brief Gets all fields attacked by the pieces of a player.
+     *
+     * \param colour  the colour of the player, must not be none
+     * \return Returns the fields that the pieces of the player attack, no
+     *         matter whether the fields are empty or occupied.
+     */
+    Bitboard attacks(const Colour colour) const;
+
+
+    /** \brief Gets the number of allowed moves of a player, see Moves::count().
+     *
+     * \param colour  the colour of the player, must not be none
+     * \return Returns the number of allowed moves of the player, if it was his
+     *         or her turn. Pawn promotions are counted once.
+     */
+    int moveCount(const Colour colour) const;
+
+
+    /** \brief Checks whether a player is checkmate.
+     *
+     * \param colour  the colour of the player
+     * \return Returns true, if the given player is checkmate, i.e. the same
+     *         as isCheckMate() for the board of the context.
+     */
+    bool isCheckMate(const Colour colour) const;
+  private:
+    /** \brief Determines the king fields and king zones of both players.
+     */
+    void determineKings() const;
+
+
+    const Board& mBoard; /**< the evaluated board */
+    mutable bool mHasKings; /**< whether kings and king zones have been determined */
+    mutable std::array<Field, 3> mKings; /**< king fields, index is the colour */
+    mutable std::array<Bitboard, 3> mKingZones; /**< king zones, index is the colour */
+    mutable std::array<Bitboard, 3> mAttacks; /**< attacked fields, index is the colour */
+    mutable std::array<bool, 3> mHasAttacks; /**< whether the attacked fields have been determined */
+    mutable std::array<int, 3> mMoveCounts; /**< numbers of allowed moves, index is the colour; negative, if not determined yet */
+}; // class
+
+} // namespace
+
+#endif // SIMPLE_CHESS_EVALUATIONCONTEXT_HPP
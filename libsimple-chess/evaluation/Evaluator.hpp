@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2020  Dirk Stolle
+    Copyright (C) 2017, 2020, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,6 +22,7 @@
 #define SIMPLE_CHESS_EVALUATOR_HPP
 
 #include "../data/Board.hpp"
+#include "EvaluationContext.hpp"
 
 namespace simplechess
 {
@@ -40,6 +41,24 @@ class Evaluator
     virtual int score(const Board& board) const = 0;
 
 
+    /** \brief Evaluates the current situation on the board, using facts about
+     *         the position that have already been determined.
+     *
+     * \param board    the board that shall be evaluated
+     * \param context  the evaluation context of the same board
+     * \return Returns the evaluation of the board in centipawns, the same as
+     *         score(board) does.
+     * \remarks Evaluators that need attacked fields, king positions or move
+     *          counts should override this method, so that those are shared
+     *          between all evaluators of a CompoundEvaluator. The default
+     *          implementation just ignores the context.
+     */
+    virtual int score(const Board& board, [[maybe_unused]] const EvaluationContext& context) const
+    {
+      return score(board);
+    }
+
+
     /** \brief Virtual destructor.
      */
     virtual ~Evaluator() { }
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2018, 2020, 2021  Dirk Stolle
+    Copyright (C) 2017, 2018, 2020, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,7 +19,6 @@
 */
 
 #include "LinearMobilityEvaluator.hpp"
-#include "../rules/Moves.hpp"
 
 namespace simplechess
 {
@@ -29,30 +28,15 @@ const int LinearMobilityEvaluator::centipawnsPerMove = 10;
 
 int LinearMobilityEvaluator::score(const Board& board) const
 {
-  Board moveBoard(board);
-  int result = 0;
-  for (int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
-  {
-    const Piece elem = board.element(static_cast<Field>(i));
-    if ((elem.colour() == Colour::none) || (elem.piece() == PieceType::none))
-      continue;
-
-    // Set current colour as the player who is to move. Otherwise moves will
-    // not be allowed.
-    moveBoard.setToMove(elem.colour());
-
-    for (int j = static_cast<int>(Field::a1); j <= static_cast<int>(Field::h8); ++j)
-    {
-      if (Moves::isAllowed(moveBoard, static_cast<Field>(i), static_cast<Field>(j)))
-      {
-        if (elem.colour() == Colour::white)
-          result += centipawnsPerMove;
-        else
-          result -= centipawnsPerMove;
-      } // if move is allowed
-    } // for j
-  } // for i
-  return result;
+  return score(board, EvaluationContext(board));
+}
+
+int LinearMobilityEvaluator::score([[maybe_unused]] const Board& board, const EvaluationContext& context) const
+{
+  // Count moves for white as positive moves, and moves for black as
+  // negative moves.
+  const int moves = context.moveCount(Colour::white) - context.moveCount(Colour::black);
+  return moves * centipawnsPerMove;
 }
 
 std::string LinearMobilityEvaluator::name() const noexcept
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2020, 2022  Dirk Stolle
+    Copyright (C) 2017, 2020, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -41,6 +41,16 @@ class LinearMobilityEvaluator: public Evaluator
     int score(const Board& board) const override;
 
 
+    /** \brief Evaluates the current situation on the board, using facts about
+     *         the position that have already been determined.
+     *
+     * \param board    the board that shall be evaluated
+     * \param context  the evaluation context of the same board
+     * \return Returns the evaluation of the board in centipawns.
+     */
+    int score(const Board& board, const EvaluationContext& context) const override;
+
+
     /** \brief Gets the name of the evaluator.
      *
      * \return Returns the name of the evaluator.
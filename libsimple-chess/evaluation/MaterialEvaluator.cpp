@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2020, 2021, 2024  Dirk Stolle
+    Copyright (C) 2017, 2020, 2021, 2024, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,53 +19,21 @@
 */
 
 #include "MaterialEvaluator.hpp"
+#include "../data/Material.hpp"
 
 namespace simplechess
 {
 
 int MaterialEvaluator::pieceValue(const PieceType& pt)
 {
-  switch(pt)
-  {
-    case PieceType::pawn:
-         return 100;
-    case PieceType::bishop:
-         return 325;
-    case PieceType::knight:
-         return 300;
-    case PieceType::rook:
-         return 500;
-    case PieceType::queen:
-         return 900;
-    // Value of king is higher than all other pieces combined, because if you
-    // loose the king you loose the game.
-    case PieceType::king:
-         return 1000000;
-    case PieceType::none:
-    default:
-         return 0;
-  }
+  return Material::value(pt);
 }
 
 int MaterialEvaluator::score(const Board& board) const
 {
-  int result = 0;
-  for (int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
-  {
-    const Piece elem = board.element(static_cast<Field>(i));
-    // Checking for colour is enough, because PieceType::none will always occur
-    // together with Colour::none. And if it should not, then pieceValue() will
-    // return zero for PieceType::none.
-    if ((elem.colour() == Colour::none))
-      continue;
-
-    const int value(pieceValue(elem.piece()));
-    if (elem.colour() == Colour::white)
-      result += value;
-    else
-      result -= value;
-  } // for
-  return result;
+  // The board keeps the material balance up to date during each move, so
+  // there is no need to look at every field.
+  return board.material();
 }
 
 std::string MaterialEvaluator::name() const noexcept
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2020, 2021  Dirk Stolle
+    Copyright (C) 2017, 2020, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -26,62 +26,26 @@ namespace simplechess
 
 int PromotionEvaluator::score(const Board& board) const
 {
-  int result = 0;
+  // Fields are numbered column by column, so the field in front of a white
+  // pawn has the next higher index, and the fields left and right to it are
+  // eight indices further away.
+  constexpr Bitboard row2 = 0x0202020202020202ull;
+  constexpr Bitboard row7 = 0x4040404040404040ull;
+  const Bitboard empty = board.pieces(Colour::none);
+
+  // White pawns on row 7 can be promoted, if the field on row 8 is empty or
+  // if the field left or right to it is occupied by the opponent.
+  const Bitboard black = board.pieces(Colour::black);
+  const Bitboard whitePawns = board.pieces(Colour::white, PieceType::pawn) & row7;
+  const Bitboard whitePromotions = whitePawns & ((empty >> 1) | (black << 7) | (black >> 9));
+
+  // Black pawns on row 2, same as above with row 1.
+  const Bitboard white = board.pieces(Colour::white);
+  const Bitboard blackPawns = board.pieces(Colour::black, PieceType::pawn) & row2;
+  const Bitboard blackPromotions = blackPawns & ((empty << 1) | (white >> 7) | (white << 9));
 
-  const auto empty = Piece(Colour::none, PieceType::none);
   const int queenValue = MaterialEvaluator::pieceValue(PieceType::queen);
-
-  // White pawns on row 7.
-  const auto whitePawn = Piece(Colour::white, PieceType::pawn);
-  for (char col = 'a'; col <= 'h'; ++col)
-  {
-    const Piece elem = board.element(toField(col, 7));
-    if (elem != whitePawn)
-      continue;
-
-    // Field on row 8 must be empty.
-    if (board.element(toField(col, 8)) == empty)
-    {
-      result += queenValue;
-    }
-    // ... or the field left or right to it is occupied by the opponent.
-    else
-    {
-      const Field center = toField(col, 8);
-      const Field left = leftField(center);
-      const Field right = rightField(center);
-      if (((left != Field::none) && (board.element(left).colour() == Colour::black))
-        || ((right != Field::none) && (board.element(right).colour() == Colour::black)))
-        result += queenValue;
-    }
-  } //for
-
-  // Black pawns on row 2.
-  const auto blackPawn = Piece(Colour::black, PieceType::pawn);
-  for (char col = 'a'; col <= 'h'; ++col)
-  {
-    const Piece elem = board.element(toField(col, 2));
-    if (elem != blackPawn)
-      continue;
-
-    // Field on row 1 must be empty.
-    if (board.element(toField(col, 1)) == empty)
-    {
-      result -= queenValue;
-    }
-    // ... or the field left or right to it is occupied by the opponent.
-    else
-    {
-      const Field center = toField(col, 1);
-      const Field left = leftField(center);
-      const Field right = rightField(center);
-      if (((left != Field::none) && (board.element(left).colour() == Colour::white))
-        || ((right != Field::none) && (board.element(right).colour() == Colour::white)))
-        result -= queenValue;
-    }
-  } //for
-
-  return result;
+  return (popCount(whitePromotions) - popCount(blackPromotions)) * queenValue;
 }
 
 std::string PromotionEvaluator::name() const noexcept
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2020, 2022  Dirk Stolle
+    Copyright (C) 2017, 2020, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -42,6 +42,10 @@ class PromotionEvaluator: public Evaluator
     int score(const Board& board) const override;
 
 
+    // Only uses the pawn bitboards of the board, so it needs no context.
+    using Evaluator::score;
+
+
     /** \brief Gets the name of the evaluator.
      *
      * \return Returns the name of the evaluator.
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2018, 2020, 2021  Dirk Stolle
+    Copyright (C) 2017, 2018, 2020, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,7 +20,6 @@
 
 #include "RootMobilityEvaluator.hpp"
 #include <cmath>
-#include "../rules/Moves.hpp"
 
 namespace simplechess
 {
@@ -30,31 +29,14 @@ const int RootMobilityEvaluator::centipawnsPerMove = 10;
 
 int RootMobilityEvaluator::score(const Board& board) const
 {
-  Board moveBoard(board);
-  int moves = 0;
-  for (int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
-  {
-    const Piece elem = board.element(static_cast<Field>(i));
-    if ((elem.colour() == Colour::none) || (elem.piece() == PieceType::none))
-      continue;
-
-    // Set current colour as the player who is to move. Otherwise moves will
-    // not be allowed.
-    moveBoard.setToMove(elem.colour());
+  return score(board, EvaluationContext(board));
+}
 
-    for (int j = static_cast<int>(Field::a1); j <= static_cast<int>(Field::h8); ++j)
-    {
-      if (Moves::isAllowed(moveBoard, static_cast<Field>(i), static_cast<Field>(j)))
-      {
-        // Count moves for white as positive moves, and moves for black as
-        // negative moves.
-        if (elem.colour() == Colour::white)
-          ++moves;
-        else
-          --moves;
-      } // if move is allowed
-    } // for j
-  } // for i
+int RootMobilityEvaluator::score([[maybe_unused]] const Board& board, const EvaluationContext& context) const
+{
+  // Count moves for white as positive moves, and moves for black as
+  // negative moves.
+  const int moves = context.moveCount(Colour::white) - context.moveCount(Colour::black);
   if (moves >= 0)
     return static_cast<int>(centipawnsPerMove * std::sqrt(moves));
   else
@@ -0,0 +1,174 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_STATICCOMPOUND_HPP
+#define SIMPLE_CHESS_STATICCOMPOUND_HPP
+
+#include <tuple>
+#include <type_traits>
+#include "Evaluator.hpp"
+
+namespace simplechess
+{
+
+/** \brief Helper to find the class that declares a score() method with an
+ *         evaluation context. Only used in unevaluated context, so there is no
+ *         definition.
+ */
+template<typename Class>
+Class* contextScoreOwner(int (Class::*)(const Board&, const EvaluationContext&) const);
+
+
+/** \brief Tells whether an evaluator declares its own score() method that
+ *         takes an EvaluationContext, i.e. whether it uses the context.
+ *
+ * \remarks Evaluators that only inherit the method from Evaluator do not use
+ *          the context, and the inherited method is just a virtual call of
+ *          score(board).
+ */
+template<typename E, typename = void>
+struct UsesEvaluationContext: std::false_type
+{
+};
+
+template<typename E>
+struct UsesEvaluationContext<E, std::void_t<decltype(contextScoreOwner(&E::score))>>
+: std::is_same<decltype(contextScoreOwner(&E::score)), E*>
+{
+};
+
+/** \brief Evaluator that considers the sum of scores of a fixed set of other
+ *         evaluators, which are given as template parameters.
+ *
+ * \remarks Unlike CompoundEvaluator the types of the evaluators are known at
+ *          compile time, so the calls of their score() methods do not need
+ *          virtual dispatch and may be inlined by the compiler.
+ */
+template<typename... Evaluators>
+class StaticCompound final: public Evaluator
+{
+  public:
+    static_assert(sizeof...(Evaluators) > 0, "StaticCompound needs at least one evaluator!");
+
+
+    /** \brief Evaluates the current situation on the board.
+     *
+     * \param board  the board that shall be evaluated
+     * \return Returns the evaluation of the board in centipawns.
+     * Positive values means that white has an advantage, negative values
+     * indicate that black has an advantage. Zero means both players are even.
+     */
+    int score(const Board& board) const override
+    {
+      // Building the context takes time, so it is only done when at least one
+      // of the evaluators uses it.
+      if constexpr (usesContext())
+      {
+        return score(board, EvaluationContext(board));
+      }
+      else
+      {
+        return std::apply([&board](const Evaluators&... evaluator)
+          {
+            // Qualified calls are resolved at compile time.
+            return (evaluator.Evaluators::score(board) + ...);
+          }, evaluators);
+      }
+    }
+
+
+    /** \brief Evaluates the current situation on the board, using facts about
+     *         the position that have already been determined.
+     *
+     * \param board    the board that shall be evaluated
+     * \param context  the evaluation context of the same board
+     * \return Returns the evaluation of the board in centipawns.
+     */
+    int score(const Board& board, const EvaluationContext& context) const override
+    {
+      return std::apply([&board, &context](const Evaluators&... evaluator)
+        {
+          return (scoreOf(evaluator, board, context) + ...);
+        }, evaluators);
+    }
+
+
+    /** \brief Gets the name of the evaluator.
+     *
+     * \return Returns the name of the evaluator.
+     * May contain additional information about the evaluator.
+     */
+    std::string name() const noexcept override
+    {
+      std::string elements = std::apply([](const Evaluators&... evaluator)
+        {
+          return ((std::string(",") + evaluator.Evaluators::name()) + ...);
+        }, evaluators);
+      elements.erase(0, 1);
+      return "StaticCompound(" + elements + ")";
+    }
+
+
+    /** \brief Gets the size of the compound, i.e. the number of evaluators in it.
+     *
+     * \return compound size
+     */
+    static constexpr std::size_t size() noexcept
+    {
+      return sizeof...(Evaluators);
+    }
+
+
+    /** \brief Tells whether any of the evaluators uses the evaluation context.
+     *
+     * \return Returns true, if at least one evaluator uses the context.
+     */
+    static constexpr bool usesContext() noexcept
+    {
+      return (UsesEvaluationContext<Evaluators>::value || ...);
+    }
+  private:
+    /** \brief Gets the score of a single evaluator without virtual dispatch.
+     *
+     * \param evaluator  the evaluator
+     * \param board      the board that shall be evaluated
+     * \param context    the evaluation context of the same board
+     * \return Returns the evaluation of the board by the given evaluator.
+     */
+    template<typename E>
+    static int scoreOf(const E& evaluator, const Board& board, const EvaluationContext& context)
+    {
+      // Qualified calls are resolved at compile time. An evaluator without
+      // its own method for the context would end up in the inherited method
+      // of Evaluator, which calls score(board) virtually, so such evaluators
+      // get the call without context.
+      if constexpr (UsesEvaluationContext<E>::value)
+        return evaluator.E::score(board, context);
+      else
+        return evaluator.E::score(board);
+    }
+
+
+    std::tuple<Evaluators...> evaluators; /**< evaluators to sum up */
+}; // class
+
+} // namespace
+
+#endif // SIMPLE_CHESS_STATICCOMPOUND_HPP
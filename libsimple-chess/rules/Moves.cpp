@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2016, 2017, 2018, 2021, 2022  Dirk Stolle
+    Copyright (C) 2016, 2017, 2018, 2021, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,36 +19,15 @@
 */
 
 #include "Moves.hpp"
+#include "attacks.hpp"
+#include <algorithm>
 #include <cmath>
+#include <initializer_list>
+#include <limits>
 
 namespace simplechess
 {
 
-constexpr int signum(const int val)
-{
-  return (0 < val) - (val < 0);
-}
-
-bool isEmptyStraightOrDiagonal(const Board& board, const Field from, const Field to)
-{
-  const int rowDiff = row(to) - row(from);
-  const int colDiff = column(to) - column(from);
-
-  int curRow = row(from) + signum(rowDiff);
-  int curCol = column(from) + signum(colDiff);
-  while ((curRow != row(to)) || (curCol != column(to)))
-  {
-    // check if field at current "coordinates" is empty - if not, return
-    if (board.element(toField(curCol, curRow)).piece() != PieceType::none)
-      return false;
-    // move to next field
-    curRow = curRow + signum(rowDiff);
-    curCol = curCol + signum(colDiff);
-  } // while
-  // All fields empty, all OK.
-  return true;
-}
-
 bool isCastlingAttemptAllowed(const Board& board, const Field from, const Field to)
 {
   const Piece & start = board.element(from);
@@ -140,15 +119,9 @@ bool allowedPatternPawnWhite(const Board& board, const Field from, const Field t
 
 bool allowedPatternRook(const Board& board, const Field from, const Field to)
 {
-  // Rook moves horizontally or vertically only, i.e. either column or row
-  // must be identical.
-  if ((column(from) == column(to)) || (row(from) == row(to)))
-  {
-    // Move is allowed, if fields between start and end are empty.
-    return isEmptyStraightOrDiagonal(board, from, to);
-  }
-  // Does not match the rook move pattern, therefore not allowed.
-  return false;
+  // Rook moves horizontally or vertically only, and all fields between start
+  // and end must be empty. The attack table takes care of both.
+  return (rookAttacks(from, board.occupied()) & fieldBit(to)) != 0;
 }
 
 bool allowedPatternKnight(const Field from, const Field to)
@@ -164,25 +137,15 @@ bool allowedPatternKnight(const Field from, const Field to)
 
 bool allowedPatternBishop(const Board& board, const Field from, const Field to)
 {
-  // Bishop moves diagonally, i.e. absolute difference between rows and columns
-  // of start and end point must be equal and non-zero.
-  const int rowDiff = std::abs(row(from) - row(to));
-  const int colDiff = std::abs(column(from) - column(to));
-  if ((colDiff == rowDiff) && (rowDiff != 0))
-  {
-    // Move is allowed, if fields between start and end are empty.
-    return isEmptyStraightOrDiagonal(board, from, to);
-  }
-  // not allowed
-  return false;
+  // Bishop moves diagonally, and all fields between start and end must be
+  // empty. The attack table takes care of both.
+  return (bishopAttacks(from, board.occupied()) & fieldBit(to)) != 0;
 }
 
 bool allowedPatternQueen(const Board& board, const Field from, const Field to)
 {
   // Queen can move like rook or like bishop.
-  if (allowedPatternRook(board, from, to))
-    return true;
-  return allowedPatternBishop(board, from, to);
+  return (queenAttacks(from, board.occupied()) & fieldBit(to)) != 0;
 }
 
 bool allowedPatternKing(const Board& board, const Field from, const Field to)
@@ -216,6 +179,482 @@ bool Moves::isAllowed(const Board& board, const Field from, const Field to)
   return !b2.isInCheck(board.toMove());
 }
 
+/** \brief Gets the field for the given zero-based column and row indices.
+ *
+ * \param col  zero-based column index
+ * \param r    zero-based row index
+ * \return Returns the field, or Field::none if the indices are off the board.
+ */
+constexpr Field fieldAt(const int col, const int r)
+{
+  if ((col < 0) || (col > 7) || (r < 0) || (r > 7))
+    return Field::none;
+  return static_cast<Field>(col * 8 + r);
+}
+
+/** \brief Checks whether a move does not put the moving player in check.
+ *
+ * \param board  the board; it is changed during the check, but restored
+ * \param from   field where the move begins
+ * \param to     field where the move ends
+ * \return Returns true, if the player to move is not in check after the move.
+ */
+bool leavesKingSafe(Board& board, const Field from, const Field to)
+{
+  const Colour player = board.toMove();
+  UndoRecord undo;
+  board.makeMove(from, to, PieceType::queen, undo);
+  const bool inCheck = board.isInCheck(player);
+  board.unmakeMove(from, to, undo);
+  return !inCheck;
+}
+
+/** \brief Adds a move to the list, if it does not put the moving player in check.
+ *
+ * \param board      the board; it is changed during the check, but restored
+ * \param from       field where the move begins
+ * \param to         field where the move ends
+ * \param promotion  whether the move is a pawn promotion
+ * \param moves      list of moves
+ */
+void addIfAllowed(Board& board, const Field from, const Field to, const bool promotion, MoveList& moves)
+{
+  if (!leavesKingSafe(board, from, to))
+    return;
+  if (!promotion)
+  {
+    moves.add(Move(from, to));
+    return;
+  }
+  // Promotions are listed once for every possible promotion piece. The type of
+  // the new piece does not matter for the check test above, because the
+  // promoted piece stands between its own king and any attacker just like the
+  // queen does.
+  moves.add(Move(from, to, PieceType::queen));
+  moves.add(Move(from, to, PieceType::knight));
+  moves.add(Move(from, to, PieceType::bishop));
+  moves.add(Move(from, to, PieceType::rook));
+}
+
+/** \brief Generates the allowed moves of a pawn.
+ *
+ * \param board  the board with the player to move set to the pawn's colour
+ * \param from   field of the pawn
+ * \param moves  list of moves
+ */
+void generatePawnMoves(Board& board, const Field from, MoveList& moves)
+{
+  const Colour player = board.toMove();
+  const int direction = (player == Colour::white) ? 1 : -1;
+  const int initialRow = (player == Colour::white) ? 1 : 6;
+  const int promotionRow = (player == Colour::white) ? 7 : 0;
+  const int col = column(from) - 'a';
+  const int r = row(from) - 1;
+
+  // one or two steps ahead onto empty fields
+  const Field ahead = fieldAt(col, r + direction);
+  if ((ahead != Field::none) && (board.element(ahead).piece() == PieceType::none))
+  {
+    addIfAllowed(board, from, ahead, r + direction == promotionRow, moves);
+    if (r == initialRow)
+    {
+      const Field twoAhead = fieldAt(col, r + 2 * direction);
+      if (board.element(twoAhead).piece() == PieceType::none)
+        addIfAllowed(board, from, twoAhead, false, moves);
+    }
+  } // if field ahead is empty
+
+  // captures, including en passant
+  for (const int colDiff : { -1, 1 })
+  {
+    const Field to = fieldAt(col + colDiff, r + direction);
+    if (to == Field::none)
+      continue;
+    const Colour destColour = board.element(to).colour();
+    if (((destColour != Colour::none) && (destColour != player))
+        || ((destColour == Colour::none) && (to == board.enPassant())))
+    {
+      addIfAllowed(board, from, to, r + direction == promotionRow, moves);
+    }
+  } // for
+}
+
+/** \brief Generates the allowed moves of a piece that moves in single steps,
+ *         i.e. king or knight.
+ *
+ * \param board  the board with the player to move set to the piece's colour
+ * \param from   field of the piece
+ * \param steps  column and row differences of the possible steps
+ * \param moves  list of moves
+ */
+void generateStepMoves(Board& board, const Field from, const int (&steps)[8][2], MoveList& moves)
+{
+  const Colour player = board.toMove();
+  const int col = column(from) - 'a';
+  const int r = row(from) - 1;
+  for (const auto& step : steps)
+  {
+    const Field to = fieldAt(col + step[0], r + step[1]);
+    if ((to != Field::none) && (board.element(to).colour() != player))
+      addIfAllowed(board, from, to, false, moves);
+  } // for
+}
+
+/** \brief Adds the allowed moves of a piece to the given target fields.
+ *
+ * \param board    the board with the player to move set to the piece's colour
+ * \param from     field of the piece
+ * \param targets  fields the piece can move to according to its pattern
+ * \param moves    list of moves
+ */
+void generateTargetMoves(Board& board, const Field from, Bitboard targets, MoveList& moves)
+{
+  // Pieces cannot capture pieces of their own colour.
+  targets &= ~board.pieces(board.toMove());
+  while (targets != 0)
+  {
+    addIfAllowed(board, from, popFirstField(targets), false, moves);
+  }
+}
+
+void Moves::generate(const Board& board, MoveList& moves)
+{
+  static const int knightSteps[8][2] = {
+    { 1, 2 }, { 2, 1 }, { 2, -1 }, { 1, -2 }, { -1, -2 }, { -2, -1 }, { -2, 1 }, { -1, 2 }
+  };
+  static const int kingSteps[8][2] = {
+    { 0, 1 }, { 1, 1 }, { 1, 0 }, { 1, -1 }, { 0, -1 }, { -1, -1 }, { -1, 0 }, { -1, 1 }
+  };
+
+  moves.clear();
+  const Colour player = board.toMove();
+  // The check test for each move needs to perform the move, so work on a copy
+  // of the board. makeMove() and unmakeMove() restore the copy after each move.
+  Board work(board);
+  for (int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
+  {
+    const Field from = static_cast<Field>(i);
+    const Piece& piece = board.element(from);
+    if (piece.colour() != player)
+      continue;
+
+    switch (piece.piece())
+    {
+      case PieceType::pawn:
+           generatePawnMoves(work, from, moves);
+           break;
+      case PieceType::knight:
+           generateStepMoves(work, from, knightSteps, moves);
+           break;
+      case PieceType::bishop:
+           generateTargetMoves(work, from, bishopAttacks(from, board.occupied()), moves);
+           break;
+      case PieceType::rook:
+           generateTargetMoves(work, from, rookAttacks(from, board.occupied()), moves);
+           break;
+      case PieceType::queen:
+           generateTargetMoves(work, from, queenAttacks(from, board.occupied()), moves);
+           break;
+      case PieceType::king:
+           generateStepMoves(work, from, kingSteps, moves);
+           // castling
+           if ((from == Field::e1) || (from == Field::e8))
+           {
+             const int r = row(from);
+             if (isCastlingAttemptAllowed(board, from, toField('c', r)))
+               addIfAllowed(work, from, toField('c', r), false, moves);
+             if (isCastlingAttemptAllowed(board, from, toField('g', r)))
+               addIfAllowed(work, from, toField('g', r), false, moves);
+           }
+           break;
+      case PieceType::none:
+           // Colour matches the player, so this will never happen.
+           break;
+    } // switch
+  } // for i
+}
+
+void Moves::generateCaptures(const Board& board, MoveList& moves)
+{
+  moves.clear();
+  const Colour player = board.toMove();
+  const Colour opponent = (player == Colour::white) ? Colour::black : Colour::white;
+  const Bitboard occupied = board.occupied();
+  const Bitboard victims = board.pieces(opponent);
+  const Bitboard promotionRow = (player == Colour::white) ? 0x8080808080808080ULL : 0x0101010101010101ULL;
+  Board work(board);
+
+  Bitboard own = board.pieces(player);
+  while (own != 0)
+  {
+    const Field from = popFirstField(own);
+    Bitboard targets = 0;
+    switch (board.element(from).piece())
+    {
+      case PieceType::pawn:
+           {
+             targets = pawnAttacks(player, from) & victims;
+             if ((board.enPassant() != Field::none)
+                 && ((pawnAttacks(player, from) & fieldBit(board.enPassant())) != 0))
+               targets |= fieldBit(board.enPassant());
+             // Promotion without capture is only possible on the field ahead
+             // of a pawn on the row before the promotion row. (Pawns on the
+             // promotion row itself have no field ahead.)
+             const int promotionFrom = (player == Colour::white) ? 7 : 2;
+             if (row(from) == promotionFrom)
+             {
+               const Field ahead = static_cast<Field>(static_cast<int>(from) + ((player == Colour::white) ? 1 : -1));
+               if ((fieldBit(ahead) & ~occupied) != 0)
+                 targets |= fieldBit(ahead);
+             }
+           }
+           break;
+      case PieceType::knight:
+           targets = knightAttacks(from) & victims;
+           break;
+      case PieceType::bishop:
+           targets = bishopAttacks(from, occupied) & victims;
+           break;
+      case PieceType::rook:
+           targets = rookAttacks(from, occupied) & victims;
+           break;
+      case PieceType::queen:
+           targets = queenAttacks(from, occupied) & victims;
+           break;
+      case PieceType::king:
+           targets = kingAttacks(from) & victims;
+           break;
+      case PieceType::none:
+           // Colour matches the player, so this will never happen.
+           break;
+    } // switch
+
+    const bool isPawn = board.element(from).piece() == PieceType::pawn;
+    while (targets != 0)
+    {
+      const Field to = popFirstField(targets);
+      if (!leavesKingSafe(work, from, to))
+        continue;
+      const bool promotion = isPawn && ((fieldBit(to) & promotionRow) != 0);
+      moves.add(Move(from, to, promotion ? PieceType::queen : PieceType::none));
+    } // while
+  } // while
+}
+
+/** \brief Gets the fields between two fields on a common row, column or
+ *         diagonal.
+ *
+ * \param a  the first field
+ * \param b  the second field
+ * \return Returns the fields between a and b, excluding a and b.
+ *         Returns zero, if the fields are not on a common line.
+ */
+Bitboard fieldsBetween(const Field a, const Field b)
+{
+  if ((row(a) == row(b)) || (column(a) == column(b)))
+    return rookAttacks(a, fieldBit(b)) & rookAttacks(b, fieldBit(a));
+  if (std::abs(row(a) - row(b)) == std::abs(column(a) - column(b)))
+    return bishopAttacks(a, fieldBit(b)) & bishopAttacks(b, fieldBit(a));
+  return 0;
+}
+
+/** \brief Gets the fields a piece other than the king can move to according
+ *         to its pattern, without en passant captures.
+ *
+ * \param board   the chess board
+ * \param player  colour of the piece
+ * \param from    field of the piece
+ * \return Returns the target fields of the piece. Moves may still put the
+ *         own king in check.
+ */
+Bitboard moveTargets(const Board& board, const Colour player, const Field from)
+{
+  const Bitboard occupied = board.occupied();
+  switch (board.element(from).piece())
+  {
+    case PieceType::pawn:
+         {
+           const Colour opponent = (player == Colour::white) ? Colour::black : Colour::white;
+           Bitboard targets = pawnAttacks(player, from) & board.pieces(opponent);
+           // Fields are numbered column by column, so one field ahead is the
+           // next (white) or previous (black) index in the same column.
+           const int direction = (player == Colour::white) ? 1 : -1;
+           const int r = row(from) - 1;
+           if ((r + direction < 0) || (r + direction > 7))
+             return targets;
+           const Field ahead = static_cast<Field>(static_cast<int>(from) + direction);
+           if ((fieldBit(ahead) & occupied) != 0)
+             return targets;
+           targets |= fieldBit(ahead);
+           if (r == ((player == Colour::white) ? 1 : 6))
+           {
+             const Field twoAhead = static_cast<Field>(static_cast<int>(ahead) + direction);
+             if ((fieldBit(twoAhead) & occupied) == 0)
+               targets |= fieldBit(twoAhead);
+           }
+           return targets;
+         }
+    case PieceType::knight:
+         return knightAttacks(from) & ~board.pieces(player);
+    case PieceType::bishop:
+         return bishopAttacks(from, occupied) & ~board.pieces(player);
+    case PieceType::rook:
+         return rookAttacks(from, occupied) & ~board.pieces(player);
+    case PieceType::queen:
+         return queenAttacks(from, occupied) & ~board.pieces(player);
+    default:
+         return 0;
+  } // switch
+}
+
+/** \brief Checks whether the king of a player is attacked after some pieces
+ *         have been moved or removed.
+ *
+ * \param board     the chess board before the move
+ * \param king      field of the king after the move
+ * \param opponent  colour of the opponent
+ * \param occupied  occupied fields after the move
+ * \return Returns true, if an opponent piece on one of the occupied fields
+ *         attacks the king.
+ */
+bool isKingAttacked(const Board& board, const Field king, const Colour opponent, const Bitboard occupied)
+{
+  return (attackersOf(board, king, occupied) & board.pieces(opponent) & occupied) != 0;
+}
+
+/** \brief Counts the allowed moves of a player, see Moves::count().
+ *
+ * \param board   the chess board
+ * \param player  the player whose moves are counted
+ * \param limit   counting stops as soon as the number of moves reaches this
+ *                limit
+ * \return Returns the number of allowed moves, but not more than the limit.
+ */
+int countAllowedMoves(const Board& board, const Colour player, const int limit)
+{
+  const Colour opponent = (player == Colour::white) ? Colour::black : Colour::white;
+  const Bitboard own = board.pieces(player);
+  const Bitboard occupied = board.occupied();
+  const Bitboard kings = board.pieces(player, PieceType::king);
+  if (popCount(kings) > 1)
+  {
+    // Not a position of a real game, but the check test of generate() only
+    // looks at the first king. So just do what generate() does.
+    Board work(board);
+    work.setToMove(player);
+    MoveList moves;
+    Moves::generate(work, moves);
+    int result = 0;
+    for (const Move& move : moves)
+    {
+      if ((move.promoteTo == PieceType::none) || (move.promoteTo == PieceType::queen))
+        ++result;
+    }
+    return std::min(result, limit);
+  }
+
+  // Without a king there are no checks and no pinned pieces.
+  Bitboard allowed = ~static_cast<Bitboard>(0);
+  Bitboard pinned = 0;
+  int result = 0;
+  const Field king = (kings != 0) ? firstField(kings) : Field::none;
+  if (king != Field::none)
+  {
+    // King moves: the king must not move onto an attacked field. The king
+    // itself is no longer in the way of sliding pieces after the move.
+    Bitboard targets = kingAttacks(king) & ~own;
+    while (targets != 0)
+    {
+      const Field to = popFirstField(targets);
+      if (!isKingAttacked(board, to, opponent, (occupied & ~fieldBit(king)) | fieldBit(to)))
+        ++result;
+      if (result >= limit)
+        return result;
+    } // while
+
+    // Castling only checks the field where the king ends up, like generate().
+    if ((king == Field::e1) || (king == Field::e8))
+    {
+      const int r = row(king);
+      if (isCastlingAttemptAllowed(board, king, toField('c', r))
+          && !isKingAttacked(board, toField('c', r), opponent,
+                             (occupied & ~fieldBit(king) & ~fieldBit(toField('a', r)))
+                             | fieldBit(toField('c', r)) | fieldBit(toField('d', r))))
+        ++result;
+      if (isCastlingAttemptAllowed(board, king, toField('g', r))
+          && !isKingAttacked(board, toField('g', r), opponent,
+                             (occupied & ~fieldBit(king) & ~fieldBit(toField('h', r)))
+                             | fieldBit(toField('g', r)) | fieldBit(toField('f', r))))
+        ++result;
+      if (result >= limit)
+        return result;
+    } // if king on initial field
+
+    // Other pieces have to capture a checking piece or block its way.
+    const Bitboard checkers = attackersOf(board, king, occupied) & board.pieces(opponent);
+    if (popCount(checkers) > 1)
+      allowed = 0;
+    else if (checkers != 0)
+      allowed = checkers | fieldsBetween(king, firstField(checkers));
+
+    // Pinned pieces may only move along the line between king and attacker.
+    const Bitboard queens = board.pieces(opponent, PieceType::queen);
+    Bitboard snipers = (rookAttacks(king, 0) & (board.pieces(opponent, PieceType::rook) | queens))
+        | (bishopAttacks(king, 0) & (board.pieces(opponent, PieceType::bishop) | queens));
+    while (snipers != 0)
+    {
+      const Field sniper = popFirstField(snipers);
+      const Bitboard between = fieldsBetween(king, sniper);
+      const Bitboard blockers = between & occupied;
+      if ((popCount(blockers) != 1) || ((blockers & own) == 0))
+        continue;
+      pinned |= blockers;
+      result += popCount(moveTargets(board, player, firstField(blockers))
+                         & (between | fieldBit(sniper)) & allowed);
+      if (result >= limit)
+        return limit;
+    } // while
+  } // if king exists
+
+  Bitboard pieces = own & ~pinned & ~kings;
+  while (pieces != 0)
+  {
+    const Field from = popFirstField(pieces);
+    result += popCount(moveTargets(board, player, from) & allowed);
+    if (result >= limit)
+      return limit;
+  } // while
+
+  // En passant captures remove a pawn that is not on the target field.
+  const Field ep = board.enPassant();
+  if ((ep != Field::none) && (board.element(ep).piece() == PieceType::none))
+  {
+    const Field captured = toField(column(ep), (row(ep) == 3) ? 4 : 5);
+    Bitboard pawns = board.pieces(player, PieceType::pawn) & pawnAttacks(opponent, ep);
+    while (pawns != 0)
+    {
+      const Field from = popFirstField(pawns);
+      const Bitboard after = (occupied & ~fieldBit(from) & ~fieldBit(captured)) | fieldBit(ep);
+      if ((king == Field::none) || !isKingAttacked(board, king, opponent, after))
+        ++result;
+      if (result >= limit)
+        return result;
+    } // while
+  } // if en passant field
+
+  return result;
+}
+
+int Moves::count(const Board& board, const Colour player)
+{
+  return countAllowedMoves(board, player, std::numeric_limits<int>::max());
+}
+
+bool Moves::hasAllowedMove(const Board& board, const Colour player)
+{
+  return countAllowedMoves(board, player, 1) > 0;
+}
+
 bool Moves::isAllowedPattern(const Board& board, const Field from, const Field to)
 {
   // If start and destination are equal, it's not a valid move.
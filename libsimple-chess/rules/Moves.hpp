@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2016, 2017, 2018  Dirk Stolle
+    Copyright (C) 2016, 2017, 2018, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -23,6 +23,7 @@
 
 #include "../data/Board.hpp"
 #include "../data/Field.hpp"
+#include "../data/MoveList.hpp"
 
 namespace simplechess
 {
@@ -40,6 +41,61 @@ class Moves
     static bool isAllowed(const Board& board, const Field from, const Field to);
 
 
+    /** \brief Generates all allowed moves of the player who is to move.
+     *
+     * \param board  the chess board
+     * \param moves  list that will receive the moves; previous content of the
+     *               list is removed
+     * \remarks The generated moves are exactly those moves for which
+     *          isAllowed() returns true. Pawn promotions are listed once for
+     *          each possible promotion piece, all other moves have the
+     *          promotion type PieceType::none.
+     */
+    static void generate(const Board& board, MoveList& moves);
+
+
+    /** \brief Generates all allowed captures and pawn promotions of the player
+     *         who is to move.
+     *
+     * \param board  the chess board
+     * \param moves  list that will receive the moves; previous content of the
+     *               list is removed
+     * \remarks Captures include en passant captures. Promotions are only listed
+     *          as promotion to a queen, because the other promotion pieces are
+     *          hardly ever better in tactical sequences.
+     */
+    static void generateCaptures(const Board& board, MoveList& moves);
+
+
+    /** \brief Counts the allowed moves of a player.
+     *
+     * \param board   the chess board
+     * \param player  the player whose moves are counted; this does not need
+     *                to be the player who is to move
+     * \return Returns the number of moves that generate() would list, if it
+     *         was the given player's turn. Pawn promotions are counted once,
+     *         not once per promotion piece.
+     * \remarks Unlike generate() this does not perform the moves. It counts
+     *          the target fields of the pieces and takes care of checks and
+     *          pinned pieces with bitboards, which is a lot faster.
+     */
+    static int count(const Board& board, const Colour player);
+
+
+    /** \brief Checks whether a player has at least one allowed move.
+     *
+     * \param board   the chess board
+     * \param player  the player whose moves are checked; this does not need
+     *                to be the player who is to move
+     * \return Returns true, if the player has at least one allowed move.
+     *         Returns false otherwise.
+     * \remarks Works like count(), but stops at the first allowed move. The
+     *          king moves are looked at first, so this is quick in positions
+     *          where the king can escape from a check.
+     */
+    static bool hasAllowedMove(const Board& board, const Colour player);
+
+
     /** \brief Checks whether a move of a piece follows its usual pattern.
      *
      * \param board  the chess board
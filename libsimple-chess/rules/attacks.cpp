@@ -0,0 +1,249 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "attacks.hpp"
+#if defined(__BMI2__) && !defined(SIMPLE_CHESS_NO_PEXT)
+  // Use the PEXT instruction of BMI2 to get the table index, if available.
+  #include <immintrin.h>
+  #define SIMPLE_CHESS_USE_PEXT
+#endif
+
+namespace simplechess
+{
+
+/** \brief Gets the fields attacked by a sliding piece in the given directions.
+ *
+ * \param f           field of the piece
+ * \param occupied    all occupied fields on the board
+ * \param directions  column and row differences of the four directions
+ * \return Returns a bitboard of attacked fields, including the first occupied
+ *         field in each direction.
+ */
+Bitboard slidingAttacks(const Field f, const Bitboard occupied, const int (&directions)[4][2])
+{
+  Bitboard result = 0;
+  const int col = static_cast<int>(f) / 8;
+  const int row = static_cast<int>(f) % 8;
+  for (const auto& dir : directions)
+  {
+    int c = col + dir[0];
+    int r = row + dir[1];
+    while ((c >= 0) && (c <= 7) && (r >= 0) && (r <= 7))
+    {
+      const Bitboard bit = static_cast<Bitboard>(1) << (c * 8 + r);
+      result |= bit;
+      // Sliding pieces cannot jump over other pieces.
+      if ((occupied & bit) != 0)
+        break;
+      c += dir[0];
+      r += dir[1];
+    } // while
+  } // for
+  return result;
+}
+
+const int rookDirections[4][2] = { { 0, 1 }, { 1, 0 }, { 0, -1 }, { -1, 0 } };
+const int bishopDirections[4][2] = { { 1, 1 }, { 1, -1 }, { -1, -1 }, { -1, 1 } };
+
+/** \brief Gets the fields whose occupancy matters for a sliding piece.
+ *
+ * \param f           field of the piece
+ * \param directions  column and row differences of the four directions
+ * \return Returns a bitboard of all fields the piece could reach on an empty
+ *         board, except for the last field in each direction. The last field
+ *         is always attacked, no matter whether it is occupied or not.
+ */
+Bitboard relevantOccupancy(const Field f, const int (&directions)[4][2])
+{
+  Bitboard result = 0;
+  const int col = static_cast<int>(f) / 8;
+  const int row = static_cast<int>(f) % 8;
+  for (const auto& dir : directions)
+  {
+    int c = col + dir[0];
+    int r = row + dir[1];
+    while ((c + dir[0] >= 0) && (c + dir[0] <= 7) && (r + dir[1] >= 0) && (r + dir[1] <= 7))
+    {
+      result |= static_cast<Bitboard>(1) << (c * 8 + r);
+      c += dir[0];
+      r += dir[1];
+    } // while
+  } // for
+  return result;
+}
+
+/** \brief Lookup data of a sliding piece for a single field. */
+struct SlidingLookup
+{
+  Bitboard mask; /**< relevant occupancy of the field */
+  Bitboard magic; /**< magic factor that maps the occupancy to an index (unused with PEXT) */
+  unsigned int shift; /**< shift that is applied to the product of occupancy and magic factor */
+  const Bitboard* attacks; /**< start of the attack table for this field */
+
+  /** \brief Gets the index into the attack table for the given occupancy.
+   *
+   * \param occupied  all occupied fields on the board
+   * \return Returns the index of the attacked fields in the attack table.
+   */
+  unsigned int index(const Bitboard occupied) const
+  {
+#if defined(SIMPLE_CHESS_USE_PEXT)
+    return static_cast<unsigned int>(_pext_u64(occupied, mask));
+#else
+    return static_cast<unsigned int>(((occupied & mask) * magic) >> shift);
+#endif
+  }
+};
+
+/* Magic factors for rooks and bishops, indexed by field. They have been
+   found by trying random sparse numbers until one of them maps all relevant
+   occupancies of a field to table indices without harmful collisions. */
+const Bitboard rookMagics[64] = {
+  0x0080005040052282ULL, 0x0440004010002000ULL, 0x2080100020000c80ULL, 0x0100042010000900ULL,
+  0x0100030004080010ULL, 0x2080040022004180ULL, 0x2100048500046200ULL, 0x4200020100402094ULL,
+  0x8108800080400020ULL, 0x08420041002e0080ULL, 0x020c808020001000ULL, 0x0002808010000800ULL,
+  0x0408800800040082ULL, 0x0802000200100805ULL, 0xc019000100020004ULL, 0x000200008c230246ULL,
+  0x008000c000600040ULL, 0x0080290040010082ULL, 0x04a0008020801000ULL, 0x0041848008001000ULL,
+  0x02a1010008001004ULL, 0xc012008080040002ULL, 0x0800808002000100ULL, 0x080102000c006081ULL,
+  0x0194802080044000ULL, 0x3000842500400100ULL, 0x4405004100182002ULL, 0x0100100080800800ULL,
+  0x0000080080800400ULL, 0x80b2100801044020ULL, 0x1000900400010288ULL, 0x4000444e0004008dULL,
+  0x0041004202002080ULL, 0x0c00402000401000ULL, 0x00a0040010100200ULL, 0x0010801000800800ULL,
+  0x0008000880800400ULL, 0x0842810400800200ULL, 0x0001000401000200ULL, 0x00108000c2800100ULL,
+  0x0040800040008021ULL, 0x4020100020404001ULL, 0x13100080e0028010ULL, 0x8248020100101000ULL,
+  0x0208008004008008ULL, 0x0154000200048080ULL, 0x0100024801140030ULL, 0x021015084882000cULL,
+  0x0150804200310200ULL, 0x0480802000400080ULL, 0x0088220210408200ULL, 0x0200100080080080ULL,
+  0x2124000408028080ULL, 0x1029008204000900ULL, 0x8000182110221400ULL, 0x4400005891040a00ULL,
+  0x100180120820c302ULL, 0x8001008930400221ULL, 0x0010110042200209ULL, 0x8243006014281001ULL,
+  0x020a000804201002ULL, 0x002a005084012802ULL, 0x0a12000401080082ULL, 0x4500010848208402ULL
+};
+
+const Bitboard bishopMagics[64] = {
+  0x0008a00112060010ULL, 0x8524080681021400ULL, 0x1410c40080200554ULL, 0x2911041080000002ULL,
+  0x9001114004000030ULL, 0x4000901008008110ULL, 0x00008e0820a40482ULL, 0x4001808290212040ULL,
+  0x8000912002440040ULL, 0x20a014108c820080ULL, 0x0001040822104101ULL, 0x0188882040400100ULL,
+  0x00c0820210201820ULL, 0x4000010108402000ULL, 0x8000022882184000ULL, 0x0601022086501020ULL,
+  0x10080c0408300408ULL, 0x8c10000421020404ULL, 0x203000020c004408ULL, 0x0408281404001000ULL,
+  0x0802001012104302ULL, 0x0401000210148c10ULL, 0x4044102504220248ULL, 0x2086008021010820ULL,
+  0x5202100009101008ULL, 0x0052501408900080ULL, 0xa0340a0104080c10ULL, 0x0002020020080808ULL,
+  0x0001001081004020ULL, 0x1014490000900800ULL, 0x60020a0044108201ULL, 0x0809005002004400ULL,
+  0x5002234010101022ULL, 0x0028085401481106ULL, 0x0806009000020029ULL, 0x0120600800110051ULL,
+  0x40c0010804450040ULL, 0x2011090202030800ULL, 0x12181514018100c0ULL, 0x91066c010242c040ULL,
+  0x0901042004c02001ULL, 0x0001090820010228ULL, 0x0400208050002040ULL, 0x8140120204210200ULL,
+  0x1088100200800810ULL, 0x4810901000200040ULL, 0x08a2101902042100ULL, 0x8210010100324100ULL,
+  0x2904884808040041ULL, 0x2202004402081a00ULL, 0x1100902c02081201ULL, 0x0000000884040122ULL,
+  0x0210100810242000ULL, 0x0000404244010840ULL, 0x000a501052004000ULL, 0x00104c682080a502ULL,
+  0x8012884110100208ULL, 0x0020004842082004ULL, 0x0090800300415000ULL, 0x0400800005048801ULL,
+  0x0001200410020626ULL, 0x0000100820640424ULL, 0x90842008100080a0ULL, 0x0410200a40820210ULL
+};
+
+/** \brief Attack tables of rooks and bishops for all fields. */
+class SlidingTables
+{
+  public:
+    /** \brief Builds the tables. */
+    SlidingTables()
+    {
+      build(rookDirections, rookMagics, rook, rookTable);
+      build(bishopDirections, bishopMagics, bishop, bishopTable);
+    }
+
+    std::array<SlidingLookup, 64> rook; /**< lookup data for rooks */
+    std::array<SlidingLookup, 64> bishop; /**< lookup data for bishops */
+  private:
+    /* Number of entries for all fields combined: Rooks need 2^10 to 2^12
+       entries per field, bishops need 2^5 to 2^9 entries. */
+    std::array<Bitboard, 102400> rookTable; /**< attacked fields for rooks */
+    std::array<Bitboard, 5248> bishopTable; /**< attacked fields for bishops */
+
+    /** \brief Builds the table for one kind of sliding piece.
+     *
+     * \param directions  column and row differences of the four directions
+     * \param magics      magic factors for all fields
+     * \param lookup      lookup data that will be filled
+     * \param table       storage for the attack tables
+     */
+    template<std::size_t n>
+    static void build(const int (&directions)[4][2], const Bitboard (&magics)[64],
+                      std::array<SlidingLookup, 64>& lookup, std::array<Bitboard, n>& table)
+    {
+      std::size_t offset = 0;
+      for (int i = 0; i < 64; ++i)
+      {
+        const Field f = static_cast<Field>(i);
+        SlidingLookup& entry = lookup[i];
+        entry.mask = relevantOccupancy(f, directions);
+        const int bits = popCount(entry.mask);
+        entry.shift = 64 - bits;
+        entry.magic = magics[i];
+        entry.attacks = &table[offset];
+
+        // Enumerate all subsets of the mask ("Carry-Rippler" trick) and store
+        // the attacks of each subset, using the slow ray based method.
+        Bitboard subset = 0;
+        do
+        {
+          table[offset + entry.index(subset)] = slidingAttacks(f, subset, directions);
+          subset = (subset - entry.mask) & entry.mask;
+        } while (subset != 0);
+
+        offset += static_cast<std::size_t>(1) << bits;
+      } // for i
+    }
+};
+
+/** the attack tables, they are built once during program start */
+const SlidingTables slidingTables;
+
+Bitboard rookAttacks(const Field f, const Bitboard occupied)
+{
+  const SlidingLookup& entry = slidingTables.rook[static_cast<int>(f)];
+  return entry.attacks[entry.index(occupied)];
+}
+
+Bitboard bishopAttacks(const Field f, const Bitboard occupied)
+{
+  const SlidingLookup& entry = slidingTables.bishop[static_cast<int>(f)];
+  return entry.attacks[entry.index(occupied)];
+}
+
+Bitboard rookAttacksSlow(const Field f, const Bitboard occupied)
+{
+  return slidingAttacks(f, occupied, rookDirections);
+}
+
+Bitboard bishopAttacksSlow(const Field f, const Bitboard occupied)
+{
+  return slidingAttacks(f, occupied, bishopDirections);
+}
+
+Bitboard attackersOf(const Board& board, const Field f, const Bitboard occupied)
+{
+  const Bitboard queens = board.pieces(PieceType::queen);
+  // A white pawn attacks f, if a black pawn on f would attack the pawn's field,
+  // and vice versa.
+  return (pawnAttacks(Colour::black, f) & board.pieces(Colour::white, PieceType::pawn))
+      | (pawnAttacks(Colour::white, f) & board.pieces(Colour::black, PieceType::pawn))
+      | (knightAttacks(f) & board.pieces(PieceType::knight))
+      | (kingAttacks(f) & board.pieces(PieceType::king))
+      | (rookAttacks(f, occupied) & (board.pieces(PieceType::rook) | queens))
+      | (bishopAttacks(f, occupied) & (board.pieces(PieceType::bishop) | queens));
+}
+
+} // namespace
@@ -0,0 +1,201 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_ATTACKS_HPP
+#define SIMPLE_CHESS_ATTACKS_HPP
+
+#include <array>
+#include <cstddef>
+#include "../data/Bitboard.hpp"
+#include "../data/Board.hpp"
+#include "../data/Piece.hpp"
+
+namespace simplechess
+{
+
+namespace detail
+{
+  /** \brief Computes the fields that can be reached from a field with one of
+   *         the given steps.
+   *
+   * \param index  numeric value of the start field
+   * \param steps  column and row differences of the steps
+   * \return Returns a bitboard of all reachable fields on the board.
+   */
+  template<std::size_t n>
+  constexpr Bitboard stepTargets(const int index, const int (&steps)[n][2])
+  {
+    Bitboard result = 0;
+    const int col = index / 8;
+    const int row = index % 8;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      const int c = col + steps[i][0];
+      const int r = row + steps[i][1];
+      if ((c >= 0) && (c <= 7) && (r >= 0) && (r <= 7))
+        result |= static_cast<Bitboard>(1) << (c * 8 + r);
+    }
+    return result;
+  }
+
+  constexpr int knightSteps[8][2] = {
+    { 1, 2 }, { 2, 1 }, { 2, -1 }, { 1, -2 }, { -1, -2 }, { -2, -1 }, { -2, 1 }, { -1, 2 }
+  };
+  constexpr int kingSteps[8][2] = {
+    { 0, 1 }, { 1, 1 }, { 1, 0 }, { 1, -1 }, { 0, -1 }, { -1, -1 }, { -1, 0 }, { -1, 1 }
+  };
+  constexpr int whitePawnSteps[2][2] = { { -1, 1 }, { 1, 1 } };
+  constexpr int blackPawnSteps[2][2] = { { -1, -1 }, { 1, -1 } };
+
+  template<std::size_t n>
+  constexpr std::array<Bitboard, 64> stepTable(const int (&steps)[n][2])
+  {
+    std::array<Bitboard, 64> table{};
+    for (int i = 0; i < 64; ++i)
+    {
+      table[i] = stepTargets(i, steps);
+    }
+    return table;
+  }
+
+  /** attacked fields of a knight, indexed by field */
+  inline constexpr std::array<Bitboard, 64> knightTable = stepTable(knightSteps);
+
+  /** attacked fields of a king, indexed by field */
+  inline constexpr std::array<Bitboard, 64> kingTable = stepTable(kingSteps);
+
+  /** attacked fields of a white pawn, indexed by field */
+  inline constexpr std::array<Bitboard, 64> whitePawnTable = stepTable(whitePawnSteps);
+
+  /** attacked fields of a black pawn, indexed by field */
+  inline constexpr std::array<Bitboard, 64> blackPawnTable = stepTable(blackPawnSteps);
+} // namespace detail
+
+
+/** \brief Gets the fields attacked by a knight.
+ *
+ * \param f  field of the knight, must not be none
+ * \return Returns a bitboard of all fields that a knight on f attacks.
+ */
+inline Bitboard knightAttacks(const Field f)
+{
+  return detail::knightTable[static_cast<int>(f)];
+}
+
+
+/** \brief Gets the fields attacked by a king, not including castling.
+ *
+ * \param f  field of the king, must not be none
+ * \return Returns a bitboard of all fields that a king on f attacks.
+ */
+inline Bitboard kingAttacks(const Field f)
+{
+  return detail::kingTable[static_cast<int>(f)];
+}
+
+
+/** \brief Gets the fields attacked by a pawn, i.e. the fields it can capture on.
+ *
+ * \param colour  colour of the pawn, must not be none
+ * \param f       field of the pawn, must not be none
+ * \return Returns a bitboard of all fields that a pawn of the given colour on
+ *         field f attacks.
+ */
+inline Bitboard pawnAttacks(const Colour colour, const Field f)
+{
+  return (colour == Colour::white) ? detail::whitePawnTable[static_cast<int>(f)]
+                                   : detail::blackPawnTable[static_cast<int>(f)];
+}
+
+
+/** \brief Gets the fields attacked by a rook.
+ *
+ * \param f         field of the rook, must not be none
+ * \param occupied  all occupied fields on the board
+ * \return Returns a bitboard of all fields that a rook on f attacks, including
+ *         the first occupied field in each direction.
+ * \remarks This is a single lookup in a table of magic bitboards (or PEXT
+ *          bitboards, if the CPU supports BMI2 and the compiler targets it).
+ *          The tables are built once during program start.
+ */
+Bitboard rookAttacks(const Field f, const Bitboard occupied);
+
+
+/** \brief Gets the fields attacked by a bishop.
+ *
+ * \param f         field of the bishop, must not be none
+ * \param occupied  all occupied fields on the board
+ * \return Returns a bitboard of all fields that a bishop on f attacks,
+ *         including the first occupied field in each direction.
+ * \remarks This is a single lookup in a table of magic bitboards (or PEXT
+ *          bitboards, if the CPU supports BMI2 and the compiler targets it).
+ */
+Bitboard bishopAttacks(const Field f, const Bitboard occupied);
+
+
+/** \brief Gets the fields attacked by a rook without using lookup tables.
+ *
+ * \param f         field of the rook, must not be none
+ * \param occupied  all occupied fields on the board
+ * \return Returns the same as rookAttacks(), but is a lot slower. It walks
+ *         along the rays field by field and is used to build the tables.
+ */
+Bitboard rookAttacksSlow(const Field f, const Bitboard occupied);
+
+
+/** \brief Gets the fields attacked by a bishop without using lookup tables.
+ *
+ * \param f         field of the bishop, must not be none
+ * \param occupied  all occupied fields on the board
+ * \return Returns the same as bishopAttacks(), but is a lot slower. It walks
+ *         along the rays field by field and is used to build the tables.
+ */
+Bitboard bishopAttacksSlow(const Field f, const Bitboard occupied);
+
+
+/** \brief Gets the fields attacked by a queen.
+ *
+ * \param f         field of the queen, must not be none
+ * \param occupied  all occupied fields on the board
+ * \return Returns a bitboard of all fields that a queen on f attacks,
+ *         including the first occupied field in each direction.
+ */
+inline Bitboard queenAttacks(const Field f, const Bitboard occupied)
+{
+  return rookAttacks(f, occupied) | bishopAttacks(f, occupied);
+}
+
+
+/** \brief Gets all pieces of both colours that attack a field.
+ *
+ * \param board     the chess board
+ * \param f         the attacked field, must not be none
+ * \param occupied  occupied fields to use for sliding pieces, usually the
+ *                  value of board.occupied()
+ * \return Returns a bitboard of all fields with pieces that attack field f.
+ * \remarks Unlike isUnderAttack() this only considers captures, i.e. a pawn
+ *          does not attack the field in front of it, and castling is no
+ *          attack either.
+ */
+Bitboard attackersOf(const Board& board, const Field f, const Bitboard occupied);
+
+} // namespace
+
+#endif // SIMPLE_CHESS_ATTACKS_HPP
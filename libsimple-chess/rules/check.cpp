@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2016, 2018, 2021  Dirk Stolle
+    Copyright (C) 2016, 2018, 2021, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,6 +19,7 @@
 */
 
 #include "check.hpp"
+#include "attacks.hpp"
 #include "Moves.hpp"
 
 namespace simplechess
@@ -42,29 +43,25 @@ bool isUnderAttack(const Board& board, const Colour by, const Field field)
 
 bool isInCheck(const Board& board, const Colour colour)
 {
-  for(int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
+  Colour opponent = Colour::none;
+  switch(colour)
   {
-    const Piece& piece = board.element(static_cast<Field>(i));
-    if ((piece.piece() == PieceType::king) && (piece.colour() == colour))
-    {
-      Colour opponent = Colour::none;
-      switch(colour)
-      {
-        case Colour::black:
-             opponent = Colour::white;
-             break;
-        case Colour::white:
-             opponent = Colour::black;
-             break;
-        case Colour::none:
-             // invalid argument, so just return false
-             return false;
-      } // switch
-      return isUnderAttack(board, opponent, static_cast<Field>(i));
-    } // if
-  } // for
+    case Colour::black:
+         opponent = Colour::white;
+         break;
+    case Colour::white:
+         opponent = Colour::black;
+         break;
+    case Colour::none:
+         // invalid argument, so just return false
+         return false;
+  } // switch
+  const Bitboard kings = board.pieces(colour, PieceType::king);
   // No king found.
-  return false;
+  if (kings == 0)
+    return false;
+  const Field king = firstField(kings);
+  return (attackersOf(board, king, board.occupied()) & board.pieces(opponent)) != 0;
 }
 
 bool isCheckMate(const Board& board, const Colour colour)
@@ -77,29 +74,20 @@ bool isCheckMate(const Board& board, const Colour colour)
   if (board.toMove() != colour)
     return false;
 
-  // The basic idea here is to check for all possible moves and check whether
-  // one of the moves leads to a position where the player is not in check any
-  // more.
-  for(int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
-  {
-    const Piece& piece = board.element(static_cast<Field>(i));
-    if (piece.colour() == colour)
-    {
-      for(int j = static_cast<int>(Field::a1); j <= static_cast<int>(Field::h8); ++j)
-      {
-        Board newBoard = board;
-        if (newBoard.move(static_cast<Field>(i), static_cast<Field>(j), PieceType::queen))
-        {
-          // Move was possible. Are we not in check any more?
-          // If so, then this is no checkmate.
-          if (!newBoard.isInCheck(colour))
-            return false;
-        } // if
-      } // for all fields (j)
-    } // if colour
-  } // for all fields (i)
-  // No move out of check found. Player is checkmate.
-  return true;
+  // Any allowed move is a way out of check, because only moves after which
+  // the player is not in check are allowed. The first one found is enough.
+  return !Moves::hasAllowedMove(board, colour);
+}
+
+bool isStalemate(const Board& board, const Colour colour)
+{
+  // Stalemate means that the player who is to move is not in check, but has
+  // no allowed move.
+  if (board.isInCheck(colour))
+    return false;
+  if (board.toMove() != colour)
+    return false;
+  return !Moves::hasAllowedMove(board, colour);
 }
 
 } // namespace
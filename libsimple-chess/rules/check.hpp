@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2016  Dirk Stolle
+    Copyright (C) 2016, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -57,6 +57,16 @@ bool isInCheck(const Board& board, const Colour colour);
  */
 bool isCheckMate(const Board& board, const Colour colour);
 
+
+/** \brief determines whether or not a player/colour is stalemate
+ *
+ * \param board   the current board
+ * \param colour  the colour to check
+ * \return Returns true, if the given player is to move, is not in check and
+ *         has no allowed move. Returns false otherwise.
+ */
+bool isStalemate(const Board& board, const Colour colour);
+
 } // namespace
 
 #endif // SIMPLE_CHESS_CHECK_HPP
@@ -0,0 +1,125 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "exchange.hpp"
+#include <algorithm>
+#include <array>
+#include "../evaluation/MaterialEvaluator.hpp"
+#include "attacks.hpp"
+
+namespace simplechess
+{
+
+/** \brief Finds the least valuable piece of a player among the attackers.
+ *
+ * \param board      the chess board
+ * \param attackers  bitboard of all attackers of both players
+ * \param player     the player whose pieces are considered
+ * \param type       receives the type of the found piece
+ * \return Returns the field of the least valuable attacker of the player.
+ *         Returns Field::none, if the player has no attackers.
+ */
+Field leastValuableAttacker(const Board& board, const Bitboard attackers, const Colour player, PieceType& type)
+{
+  for (const PieceType pt : { PieceType::pawn, PieceType::knight, PieceType::bishop,
+                              PieceType::rook, PieceType::queen, PieceType::king })
+  {
+    const Bitboard candidates = attackers & board.pieces(player, pt);
+    if (candidates != 0)
+    {
+      type = pt;
+      return firstField(candidates);
+    }
+  } // for
+  return Field::none;
+}
+
+int see(const Board& board, const Move& move)
+{
+  const Piece moving = board.element(move.from);
+  PieceType victim = board.element(move.to).piece();
+  Bitboard occupied = board.occupied();
+  if ((moving.piece() == PieceType::pawn) && (move.to == board.enPassant())
+      && (victim == PieceType::none) && (column(move.from) != column(move.to)))
+  {
+    // En passant: The captured pawn is not on the destination field.
+    victim = PieceType::pawn;
+    occupied &= ~fieldBit(toField(column(move.to), row(move.from)));
+  }
+
+  // gain[d] is the material balance after d + 1 captures, as seen from the
+  // player who made the last of them.
+  std::array<int, 32> gain;
+  unsigned int d = 0;
+  gain[0] = MaterialEvaluator::pieceValue(victim);
+  PieceType onField = moving.piece();
+  if (move.isPromotion())
+  {
+    gain[0] += MaterialEvaluator::pieceValue(move.promoteTo) - MaterialEvaluator::pieceValue(PieceType::pawn);
+    onField = move.promoteTo;
+  }
+  occupied &= ~fieldBit(move.from);
+  Colour player = (moving.colour() == Colour::white) ? Colour::black : Colour::white;
+
+  while (d + 1 < gain.size())
+  {
+    ++d;
+    // Balance, if the player captures the piece on the field.
+    gain[d] = MaterialEvaluator::pieceValue(onField) - gain[d - 1];
+    // Attackers are recalculated with the current occupancy, so that sliding
+    // pieces behind pieces that have already captured join in.
+    const Bitboard attackers = attackersOf(board, move.to, occupied) & occupied;
+    PieceType type = PieceType::none;
+    const Field from = leastValuableAttacker(board, attackers, player, type);
+    if (from == Field::none)
+      break;
+    const Colour opponent = (player == Colour::white) ? Colour::black : Colour::white;
+    if ((type == PieceType::king)
+        && ((attackers & board.pieces(opponent)) != 0))
+    {
+      // The king must not capture a defended piece.
+      break;
+    }
+    occupied &= ~fieldBit(from);
+    onField = type;
+    player = opponent;
+  } // while
+
+  // Go back through the exchange: Each player may stop capturing, if that is
+  // better than going on. The last entry is the balance of a capture that
+  // does not happen.
+  while (--d > 0)
+  {
+    gain[d - 1] = -std::max(-gain[d - 1], gain[d]);
+  }
+  return gain[0];
+}
+
+bool losesMaterial(const Board& board, const Move& move)
+{
+  const PieceType victim = board.element(move.to).piece();
+  const PieceType attacker = board.element(move.from).piece();
+  if (!move.isPromotion() && (victim != PieceType::none)
+      && (MaterialEvaluator::pieceValue(victim) >= MaterialEvaluator::pieceValue(attacker)))
+    return false;
+  return see(board, move) < 0;
+}
+
+} // namespace
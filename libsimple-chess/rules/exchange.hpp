@@ -0,0 +1,61 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_EXCHANGE_HPP
+#define SIMPLE_CHESS_EXCHANGE_HPP
+
+#include "../data/Board.hpp"
+#include "../data/Move.hpp"
+
+namespace simplechess
+{
+
+/** \brief Calculates the static exchange evaluation (SEE) of a move, i.e. the
+ *         material balance after all captures on the destination field.
+ *
+ * \param board  the current board
+ * \param move   the move, usually a capture - must be allowed on the board
+ * \return Returns the material the player to move wins (positive value) or
+ *         loses (negative value) in centipawns, if both players capture on
+ *         the destination field with their least valuable piece first and
+ *         stop as soon as further captures would lose material.
+ * \remarks Pieces behind sliding pieces (x-rays) join the exchange once the
+ *          piece in front of them has captured. Pins and checks on other
+ *          fields are not considered.
+ */
+int see(const Board& board, const Move& move);
+
+
+/** \brief Checks whether a move loses material in the exchange on its
+ *         destination field.
+ *
+ * \param board  the current board
+ * \param move   the move - must be allowed on the board
+ * \return Returns true, if the static exchange evaluation of the move is
+ *         negative. Returns false otherwise.
+ * \remarks This is faster than see(), because captures of pieces that are at
+ *          least as valuable as the capturing piece never lose material, so
+ *          they need no full exchange evaluation.
+ */
+bool losesMaterial(const Board& board, const Move& move);
+
+} // namespace
+
+#endif // SIMPLE_CHESS_EXCHANGE_HPP
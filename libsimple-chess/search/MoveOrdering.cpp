@@ -0,0 +1,223 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "MoveOrdering.hpp"
+#include "../rules/exchange.hpp"
+
+namespace simplechess
+{
+
+/** \brief Gets the value of a piece type for the MVV-LVA ordering.
+ *
+ * \param pt  the piece type
+ * \return Returns the ordering value of the piece type.
+ */
+constexpr int orderingValue(const PieceType pt)
+{
+  switch (pt)
+  {
+    case PieceType::pawn:
+         return 1;
+    case PieceType::knight:
+    case PieceType::bishop:
+         return 3;
+    case PieceType::rook:
+         return 5;
+    case PieceType::queen:
+         return 9;
+    case PieceType::king:
+         return 20;
+    default:
+         return 0;
+  } // switch
+}
+
+// Sort keys of the different move categories. Each category is well above
+// the range of the next one.
+const int hashMoveKey = 1 << 30;
+const int tacticalKey = 1 << 29;
+const int killerKey = 1 << 28;
+const int losingCaptureKey = 1 << 27;
+// History values are halved when they exceed this limit, so they always stay
+// below the keys of killer moves.
+const int historyLimit = 1 << 20;
+
+MoveOrdering::MoveOrdering()
+: killers(),
+  historyTable()
+{
+  clear();
+}
+
+void MoveOrdering::clear()
+{
+  for (auto& slots : killers)
+  {
+    slots.fill(Move());
+  }
+  historyTable.fill(0);
+}
+
+void MoveOrdering::age(const unsigned int plys)
+{
+  for (unsigned int ply = 0; ply < maxPly; ++ply)
+  {
+    if (ply + plys < maxPly)
+      killers[ply] = killers[ply + plys];
+    else
+      killers[ply].fill(Move());
+  } // for
+  for (int& value : historyTable)
+  {
+    value /= 2;
+  }
+}
+
+bool MoveOrdering::isTactical(const Board& board, const Move& move)
+{
+  if (move.isPromotion())
+    return true;
+  if (board.element(move.to).piece() != PieceType::none)
+    return true;
+  return (move.to == board.enPassant())
+      && (board.element(move.from).piece() == PieceType::pawn);
+}
+
+std::size_t MoveOrdering::historyIndex(const Colour player, const Move& move)
+{
+  return ((player == Colour::white) ? 0 : 4096)
+       + static_cast<std::size_t>(move.from) * 64
+       + static_cast<std::size_t>(move.to);
+}
+
+int MoveOrdering::history(const Colour player, const Move& move) const
+{
+  return historyTable[historyIndex(player, move)];
+}
+
+bool MoveOrdering::isKiller(const Move& move, const unsigned int ply) const
+{
+  if (ply >= maxPly)
+    return false;
+  return (killers[ply][0] == move) || (killers[ply][1] == move);
+}
+
+void MoveOrdering::order(const Board& board, MoveList& moves, const Move& hashMove, const unsigned int ply) const
+{
+  std::array<int, MoveList::capacity> keys;
+  const Colour player = board.toMove();
+  for (std::size_t i = 0; i < moves.size(); ++i)
+  {
+    const Move& move = moves[i];
+    int key = 0;
+    if (move == hashMove)
+    {
+      key = hashMoveKey;
+    }
+    else if (isTactical(board, move))
+    {
+      // Captures that lose material in the exchange on the destination field
+      // are tried after the killer moves.
+      key = (losesMaterial(board, move) ? losingCaptureKey : tacticalKey) + mvvLva(board, move);
+    }
+    else if (isKiller(move, ply))
+    {
+      // The newer killer move is tried first.
+      key = (killers[ply][0] == move) ? killerKey + 1 : killerKey;
+    }
+    else
+    {
+      key = history(player, move);
+    }
+    keys[i] = key;
+  } // for
+  sortByKeys(moves, keys);
+}
+
+void MoveOrdering::orderCaptures(const Board& board, MoveList& moves)
+{
+  std::array<int, MoveList::capacity> keys;
+  std::size_t kept = 0;
+  for (std::size_t i = 0; i < moves.size(); ++i)
+  {
+    const Move move = moves[i];
+    if (losesMaterial(board, move))
+      continue;
+    moves[kept] = move;
+    keys[kept] = mvvLva(board, move);
+    ++kept;
+  } // for
+  moves.truncate(kept);
+  sortByKeys(moves, keys);
+}
+
+int MoveOrdering::mvvLva(const Board& board, const Move& move)
+{
+  // En passant captures have an empty destination, but capture a pawn.
+  const PieceType victim = board.element(move.to).piece();
+  const int victimValue = (victim == PieceType::none) ? ((move.isPromotion()) ? 0 : 1) : orderingValue(victim);
+  const int promotionValue = move.isPromotion() ? orderingValue(move.promoteTo) : 0;
+  return 64 * (victimValue + promotionValue) - orderingValue(board.element(move.from).piece());
+}
+
+void MoveOrdering::sortByKeys(MoveList& moves, std::array<int, MoveList::capacity>& keys)
+{
+  // Insertion sort, descending by key. Move lists are short, so this is fast
+  // enough, and it keeps the generation order for equal keys.
+  for (std::size_t i = 1; i < moves.size(); ++i)
+  {
+    const Move move = moves[i];
+    const int key = keys[i];
+    std::size_t j = i;
+    while ((j > 0) && (keys[j - 1] < key))
+    {
+      moves[j] = moves[j - 1];
+      keys[j] = keys[j - 1];
+      --j;
+    } // while
+    moves[j] = move;
+    keys[j] = key;
+  } // for
+}
+
+void MoveOrdering::cutoff(const Board& board, const Move& move, const unsigned int depth, const unsigned int ply)
+{
+  if (isTactical(board, move))
+    return;
+
+  if ((ply < maxPly) && (killers[ply][0] != move))
+  {
+    killers[ply][1] = killers[ply][0];
+    killers[ply][0] = move;
+  }
+
+  int& value = historyTable[historyIndex(board.toMove(), move)];
+  value += static_cast<int>(depth * depth);
+  if (value >= historyLimit)
+  {
+    // Keep the relation between the values, but make room for new ones.
+    for (int& v : historyTable)
+    {
+      v /= 2;
+    }
+  }
+}
+
+} // namespace
@@ -0,0 +1,167 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_MOVEORDERING_HPP
+#define SIMPLE_CHESS_MOVEORDERING_HPP
+
+#include <array>
+#include "../data/Board.hpp"
+#include "../data/MoveList.hpp"
+
+namespace simplechess
+{
+
+/** \brief Sorts moves so that the most promising moves are searched first.
+ *
+ * \remarks The order is:
+ *          1. the best move from the transposition table (hash move),
+ *          2. captures and promotions that do not lose material according
+ *             to the static exchange evaluation, most valuable victim first
+ *             and least valuable attacker first for the same victim
+ *             (MVV-LVA),
+ *          3. killer moves, i.e. quiet moves that caused a beta cut-off in
+ *             another position at the same ply,
+ *          4. captures and promotions that lose material, by MVV-LVA,
+ *          5. other quiet moves, ordered by the history heuristic.
+ *          None of these requires an evaluation of the position after the move.
+ */
+class MoveOrdering
+{
+  public:
+    /** \brief Constructor. Starts with empty killer and history tables. */
+    MoveOrdering();
+
+
+    /** \brief Removes all killer moves and history values. */
+    void clear();
+
+
+    /** \brief Ages killer moves and history values for a later search, so
+     *         that they still help, but do not dominate the new results.
+     *
+     * \param plys  number of plys the root of the next search is ahead of the
+     *              root of the last search, usually two (own move and reply)
+     * \remarks Killer moves move closer to the root by the given number of
+     *          plys, and all history values are halved.
+     */
+    void age(const unsigned int plys);
+
+
+    /** \brief Sorts a list of moves.
+     *
+     * \param board     the position in which the moves are made
+     * \param moves     the moves to sort
+     * \param hashMove  best move from the transposition table, may be empty
+     * \param ply       distance to the root position in plys
+     */
+    void order(const Board& board, MoveList& moves, const Move& hashMove, const unsigned int ply) const;
+
+
+    /** \brief Sorts a list of captures and promotions for the quiescence
+     *         search and removes those that lose material.
+     *
+     * \param board  the position in which the moves are made
+     * \param moves  the captures and promotions to sort
+     * \remarks The static exchange evaluation is done only once per move, so
+     *          the quiescence search does not need to do it again. The
+     *          remaining moves are ordered by MVV-LVA.
+     */
+    static void orderCaptures(const Board& board, MoveList& moves);
+
+
+    /** \brief Updates killer moves and history after a quiet move caused a
+     *         beta cut-off.
+     *
+     * \param board  the position in which the move was made
+     * \param move   the move that caused the cut-off
+     * \param depth  remaining search depth of the position in plys
+     * \param ply    distance to the root position in plys
+     * \remarks Captures and promotions are ignored, because they are ordered
+     *          by MVV-LVA anyway.
+     */
+    void cutoff(const Board& board, const Move& move, const unsigned int depth, const unsigned int ply);
+
+
+    /** \brief Gets the history value of a move.
+     *
+     * \param player  the player who makes the move
+     * \param move    the move
+     * \return Returns the history value. Higher values mean that the move
+     *         caused more cut-offs in the past.
+     */
+    int history(const Colour player, const Move& move) const;
+
+
+    /** \brief Checks whether a move is a killer move at the given ply.
+     *
+     * \param move  the move
+     * \param ply   distance to the root position in plys
+     * \return Returns true, if the move is one of the killer moves of the ply.
+     */
+    bool isKiller(const Move& move, const unsigned int ply) const;
+
+
+    /** \brief Checks whether a move is a capture or a promotion.
+     *
+     * \param board  the position in which the move is made
+     * \param move   the move
+     * \return Returns true, if the move captures a piece (including en passant)
+     *         or promotes a pawn.
+     */
+    static bool isTactical(const Board& board, const Move& move);
+
+
+    /** Maximum ply for which killer moves are kept. */
+    static constexpr unsigned int maxPly = 128;
+  private:
+    /** \brief Gets the index of a move in the history table.
+     *
+     * \param player  the player who makes the move
+     * \param move    the move
+     * \return Returns the index.
+     */
+    static std::size_t historyIndex(const Colour player, const Move& move);
+
+
+    /** \brief Gets the MVV-LVA value of a capture or promotion.
+     *
+     * \param board  the position in which the move is made
+     * \param move   the capture or promotion
+     * \return Returns a value that is higher for more valuable victims and
+     *         less valuable attackers.
+     */
+    static int mvvLva(const Board& board, const Move& move);
+
+
+    /** \brief Sorts moves by descending keys, keeping the order of equal keys.
+     *
+     * \param moves  the moves to sort
+     * \param keys   the sort key of each move, sorted along with the moves
+     */
+    static void sortByKeys(MoveList& moves, std::array<int, MoveList::capacity>& keys);
+
+
+    std::array<std::array<Move, 2>, maxPly> killers; /**< two killer moves per ply */
+    std::array<int, 2 * 64 * 64> historyTable; /**< history values by player, origin and destination */
+}; // class
+
+} // namespace
+
+#endif // SIMPLE_CHESS_MOVEORDERING_HPP
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017, 2018, 2021, 2022, 2024  Dirk Stolle
+    Copyright (C) 2017, 2018, 2021, 2022, 2024, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,150 +20,808 @@
 
 #include "Search.hpp"
 #include <algorithm>
-#include <map>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "../rules/exchange.hpp"
 #include "../rules/Moves.hpp"
 
 namespace simplechess
 {
 
+/** \brief Evaluates a position from the view of the player who is to move.
+ *
+ * \param board  the position to evaluate
+ * \param eval   the evaluator
+ * \return Returns the score of the board, where positive values are good for
+ *         the player who is to move.
+ */
+int relativeScore(const Board& board, const Evaluator& eval)
+{
+  const int score = eval.score(board);
+  return (board.toMove() == Colour::white) ? score : -score;
+}
+
+/** \brief Counts the pieces of a player that are neither pawns nor king.
+ *
+ * \param board  the position
+ * \param player  the player whose pieces are counted
+ * \return Returns the number of knights, bishops, rooks and queens.
+ */
+unsigned int nonPawnPieces(const Board& board, const Colour player)
+{
+  const Bitboard pieces = board.pieces(player)
+      & ~board.pieces(PieceType::pawn) & ~board.pieces(PieceType::king);
+  return static_cast<unsigned int>(popCount(pieces));
+}
+
+/** \brief Checks whether neither player has enough material to checkmate.
+ *
+ * \param board  the position
+ * \return Returns true, if there are only kings and at most one knight or
+ *         bishop, or if all other pieces are bishops on fields of the same
+ *         colour. Returns false otherwise.
+ */
+bool insufficientMaterial(const Board& board)
+{
+  if ((board.pieces(PieceType::pawn) | board.pieces(PieceType::rook)
+       | board.pieces(PieceType::queen)) != 0)
+    return false;
+  const Bitboard minors = board.pieces(PieceType::knight) | board.pieces(PieceType::bishop);
+  if (popCount(minors) <= 1)
+    return true;
+  if (board.pieces(PieceType::knight) != 0)
+    return false;
+  // Bishops that all move on fields of the same colour can never mate.
+  constexpr Bitboard darkFields = 0xAA55AA55AA55AA55ull;
+  const Bitboard bishops = board.pieces(PieceType::bishop);
+  return ((bishops & darkFields) == 0) || ((bishops & ~darkFields) == 0);
+}
+
+/** \brief Converts a score to the format of the transposition table.
+ *
+ * \param score  score of a position as seen from the current ply
+ * \param ply    distance to the root position in plys
+ * \return Returns the score as seen from the position itself.
+ * \remarks Mate scores depend on the distance to the root, but entries of the
+ *          transposition table may be used at other distances, too. So mate
+ *          scores are stored relative to the position instead.
+ */
+int scoreToTable(const int score, const unsigned int ply)
+{
+  if (score >= Search::mateScore - 1000)
+    return score + static_cast<int>(ply);
+  if (score <= -Search::mateScore + 1000)
+    return score - static_cast<int>(ply);
+  return score;
+}
+
+/** \brief Converts a score from the transposition table to a search score.
+ *
+ * \param score  score of a position as stored in the transposition table
+ * \param ply    distance to the root position in plys
+ * \return Returns the score as seen from the current ply.
+ */
+int scoreFromTable(const int score, const unsigned int ply)
+{
+  if (score >= Search::mateScore - 1000)
+    return score - static_cast<int>(ply);
+  if (score <= -Search::mateScore + 1000)
+    return score + static_cast<int>(ply);
+  return score;
+}
+
 Search::Search(const Board& board)
-: root(board, Field::none, Field::none, PieceType::none, 0),
-  searchDepth(0)
+: ownTable(std::make_unique<TranspositionTable>()),
+  table(*ownTable),
+  ordering(MoveOrdering()),
+  searchOptions(SearchOptions()),
+  rootBoard(board),
+  bestOrigin(Field::none),
+  bestDestination(Field::none),
+  bestPromotion(PieceType::none),
+  bestScore(0),
+  searchDepth(0),
+  nodeCount(0),
+  quiescenceNodeCount(0),
+  useDeadline(false),
+  deadline(std::chrono::steady_clock::time_point::max()),
+  nodeLimit(0),
+  aborted(false),
+  threadCount(1),
+  stopHelpers(false),
+  stopSignal(nullptr),
+  helpers(),
+  publishedNodes(0),
+  selectiveDepth(0),
+  pv(),
+  gameHistory(),
+  path(),
+  repetitionStart(0),
+  infoCallback(),
+  startTime(std::chrono::steady_clock::now()),
+  lastInfo(startTime),
+  ponderSignal(nullptr),
+  pondering(false),
+  limitStart(startTime),
+  hardTimeLimit()
 {
 }
 
+Search::Search(const Board& board, TranspositionTable& table)
+: ownTable(nullptr),
+  table(table),
+  ordering(MoveOrdering()),
+  searchOptions(SearchOptions()),
+  rootBoard(board),
+  bestOrigin(Field::none),
+  bestDestination(Field::none),
+  bestPromotion(PieceType::none),
+  bestScore(0),
+  searchDepth(0),
+  nodeCount(0),
+  quiescenceNodeCount(0),
+  useDeadline(false),
+  deadline(std::chrono::steady_clock::time_point::max()),
+  nodeLimit(0),
+  aborted(false),
+  threadCount(1),
+  stopHelpers(false),
+  stopSignal(nullptr),
+  helpers(),
+  publishedNodes(0),
+  selectiveDepth(0),
+  pv(),
+  gameHistory(),
+  path(),
+  repetitionStart(0),
+  infoCallback(),
+  startTime(std::chrono::steady_clock::now()),
+  lastInfo(startTime),
+  ponderSignal(nullptr),
+  pondering(false),
+  limitStart(startTime),
+  hardTimeLimit()
+{
+}
+
+void Search::reset()
+{
+  bestOrigin = Field::none;
+  bestDestination = Field::none;
+  bestPromotion = PieceType::none;
+  bestScore = -infinity;
+  searchDepth = 0;
+  nodeCount = 0;
+  quiescenceNodeCount = 0;
+  useDeadline = false;
+  deadline = std::chrono::steady_clock::time_point::max();
+  nodeLimit = 0;
+  aborted = false;
+  publishedNodes.store(0, std::memory_order_relaxed);
+  selectiveDepth = 0;
+  pv.clear();
+  startTime = std::chrono::steady_clock::now();
+  lastInfo = startTime;
+  pondering = false;
+  limitStart = startTime;
+  hardTimeLimit.reset();
+  // Killer moves and history are kept: They are still useful, if the same
+  // instance searches again, or if they were set via setMoveOrdering().
+  table.newSearch();
+}
+
 void Search::search(const Evaluator& eval, const unsigned int depth)
 {
-  // Currently only up to one ply may be searched, because deeper levels of the
-  // search tree will not be looked into when getting the best move. Yet.
-  const unsigned int maximumSearchDepth = 2;
+  reset();
+  // The real search depth must not be zero (std::max(1u, ...) takes care of
+  // that), so that we get at least some moves.
+  searchRoot(eval, std::max(1u, depth));
+}
 
-  // Clear children, if any.
-  root.children.clear();
-  // The real search depth must not be zero (std::max(1u, ...) takes care of that),
-  // so that we get at least some moves. The search depth must also not be
-  // greater than the maximum supported search depth (the std::min(...) part
-  // takes care of that) to avoid exhaustive time and resource consumption.
-  searchDepth = std::max(1u , std::min(depth, maximumSearchDepth));
-  // Expand search node into tree.
-  expandNode(root, eval, searchDepth);
+void Search::search(const Evaluator& eval, const unsigned int maxDepth, const std::chrono::milliseconds& timeLimit)
+{
+  SearchLimits limits;
+  limits.depth = maxDepth;
+  limits.softTime = timeLimit / 2;
+  limits.hardTime = timeLimit;
+  search(eval, limits);
 }
 
-std::tuple<Field, Field, PieceType> Search::bestMove() const
+void Search::search(const Evaluator& eval, const SearchLimits& limits)
 {
-  // If there are no moves, then there's nothing we can do here.
-  if (!hasMove())
+  reset();
+  // While pondering, the time limits do not apply yet.
+  pondering = (ponderSignal != nullptr) && ponderSignal->load();
+  hardTimeLimit = limits.hardTime;
+  if (hardTimeLimit.has_value() && !pondering)
   {
-    return std::tuple<Field, Field, PieceType>(Field::none, Field::none, PieceType::none);
+    deadline = limitStart + hardTimeLimit.value();
   }
-  if (searchDepth >= 2)
-    return bestMoveTwoPly();
-  else
-    return bestMoveOnePly();
+  nodeLimit = limits.nodes;
+  const unsigned int lastDepth = std::max(1u, limits.depth);
+
+  // Start helper threads. They only communicate with the main search via the
+  // transposition table and the stop flag.
+  stopHelpers.store(false);
+  helpers.clear();
+  std::vector<std::thread> workers;
+  for (unsigned int i = 1; i < threadCount; ++i)
+  {
+    helpers.push_back(std::make_unique<Search>(rootBoard, table));
+    Search& helper = *helpers.back();
+    helper.ordering = ordering;
+    helper.searchOptions = searchOptions;
+    helper.gameHistory = gameHistory;
+    // Helpers have no deadline of their own, because the main search tells
+    // them when to stop.
+    helper.stopSignal = &stopHelpers;
+    workers.emplace_back(&Search::helperSearch, &helper, std::cref(eval), lastDepth, i);
+  }
+
+  for (unsigned int depth = 1; depth <= lastDepth; ++depth)
+  {
+    // The first iteration always has to finish, or there would be no move.
+    useDeadline = depth > 1;
+    if (useDeadline && (stopSignal != nullptr) && stopSignal->load())
+      break;
+    if (!searchRoot(eval, depth))
+      break;
+    if (infoCallback)
+      sendInfo(true);
+    // No need to search deeper, if there are no moves or a mate was found.
+    if (!hasMove() || (std::abs(bestScore) >= mateScore - 1000))
+      break;
+    // The next iteration usually takes several times as long as the current
+    // one. If the soft time limit is reached, then it is unlikely to complete
+    // the next iteration, so do not start it.
+    const auto now = std::chrono::steady_clock::now();
+    checkPonderHit(now);
+    if (limits.softTime.has_value() && !pondering
+        && (now - limitStart >= limits.softTime.value()))
+      break;
+  } // for
+
+  stopHelpers.store(true);
+  for (std::thread& worker : workers)
+  {
+    worker.join();
+  }
+  for (const auto& helper : helpers)
+  {
+    nodeCount += helper->nodeCount;
+    quiescenceNodeCount += helper->quiescenceNodeCount;
+    // A helper may have completed a deeper iteration than the main search.
+    // Its result is more reliable then.
+    if ((helper->searchDepth > searchDepth) && helper->hasMove()
+        && (std::abs(bestScore) < mateScore - 1000))
+    {
+      searchDepth = helper->searchDepth;
+      bestScore = helper->bestScore;
+      bestOrigin = helper->bestOrigin;
+      bestDestination = helper->bestDestination;
+      bestPromotion = helper->bestPromotion;
+      pv = helper->pv;
+    }
+  } // for
+  helpers.clear();
 }
 
-std::tuple<Field, Field, PieceType> Search::bestMoveOnePly() const
+void Search::helperSearch(const Evaluator& eval, const unsigned int maxDepth, const unsigned int index)
 {
-  // Simple strategy: Get the move with the minimum or maximum score, depending
-  // on the side who is to move in the original position. Since the child nodes
-  // of an expanded search node are sorted by score in ascending order, the 1st
-  // (or front) node has the lowest score, and the last (or back) node has the
-  // highest score.
-  Field from = Field::none;
-  Field to = Field::none;
-  PieceType promo = PieceType::queen;
-  if (root.board.toMove() == Colour::black)
+  useDeadline = true;
+  for (unsigned int depth = 1 + (index % 2); depth <= maxDepth; ++depth)
   {
-    from = root.children.front()->origin;
-    to = root.children.front()->destination;
-    promo = root.children.front()->promoteTo;
-  }
-  else
+    if (!searchRoot(eval, depth))
+      break;
+    if (!hasMove() || (std::abs(bestScore) >= mateScore - 1000))
+      break;
+  } // for
+}
+
+bool Search::searchRoot(const Evaluator& eval, const unsigned int depth)
+{
+  // Aspiration windows: The score usually changes only a little bit from one
+  // iteration to the next, so search with a narrow window around the score of
+  // the previous iteration first. That gives more cut-offs. If the score is
+  // outside of the window, then the window is widened and the root is searched
+  // again.
+  int alpha = -infinity;
+  int beta = infinity;
+  int delta = aspirationWindow;
+  const bool aspiration = (depth >= aspirationMinDepth) && (searchDepth + 1 == depth)
+                       && (std::abs(bestScore) < mateScore - 1000);
+  if (aspiration)
   {
-    from = root.children.back()->origin;
-    to = root.children.back()->destination;
-    promo = root.children.back()->promoteTo;
+    alpha = std::max(bestScore - delta, -infinity);
+    beta = std::min(bestScore + delta, infinity);
   }
-  return std::tuple<Field, Field, PieceType>(from, to, promo);
+  Move best;
+  int bestValue = -infinity;
+  while (true)
+  {
+    if (!searchRootWindow(eval, depth, alpha, beta, best, bestValue))
+      return false;
+    if ((bestValue <= alpha) && (alpha > -infinity))
+    {
+      // Fail low: The score is not better than alpha. Keep beta close, because
+      // the real score is probably not far below alpha.
+      beta = (alpha + beta) / 2;
+      alpha = std::max(bestValue - delta, -infinity);
+    }
+    else if ((bestValue >= beta) && (beta < infinity))
+    {
+      beta = std::min(bestValue + delta, infinity);
+    }
+    else
+      break;
+    delta *= 2;
+    // Once the window is large enough, the search is as fast with the full
+    // window, and mate scores are not cut off.
+    if (delta >= aspirationMaxWindow)
+    {
+      alpha = -infinity;
+      beta = infinity;
+    }
+  } // while
+
+  searchDepth = depth;
+  bestScore = bestValue;
+  bestOrigin = best.from;
+  bestDestination = best.to;
+  // The tuple returned by bestMove() uses queen for moves without
+  // promotion, so stay consistent with that.
+  bestPromotion = best.empty() ? PieceType::none
+                : (best.isPromotion() ? best.promoteTo : PieceType::queen);
+  if (!best.empty())
+    table.store(rootBoard.hash(), depth, Bound::exact, scoreToTable(bestValue, 0), best);
+  updatePrincipalVariation(best);
+  return true;
 }
 
-std::tuple<Field, Field, PieceType> Search::bestMoveTwoPly() const
+bool Search::searchRootWindow(const Evaluator& eval, const unsigned int depth, int alpha, const int beta, Move& best, int& bestValue)
 {
-  // Basic idea: The best move is the one where the best possible reply of the
-  // opponent has the worst score for the opponent. Even better are the moves
-  // where the opponent has no reply at all, because that usually means
-  // checkmate.
+  ++nodeCount;
 
-  // First: Search for checkmate moves.
-  for (const auto& node : root.children)
+  // All positions of the search are visited on the same board via
+  // makeMove() and unmakeMove(), so there is no need to copy boards.
+  Board board(rootBoard);
+  UndoRecord undo;
+  MoveList moves;
+  Moves::generate(board, moves);
+  // The best move of the previous iteration (or of the previous window) is in
+  // the table, so it is searched first.
+  TranspositionTable::Entry entry;
+  const bool found = table.probe(board.hash(), entry);
+  ordering.order(board, moves, found ? entry.move : Move(), 0);
+  best = Move();
+  bestValue = -infinity;
+  // The search path starts with the game history, so that repetitions of
+  // earlier positions of the game are detected, too.
+  path = gameHistory;
+  path.push_back(board.hash());
+  repetitionStart = 0;
+  bool first = true;
+  for (const Move& move : moves)
   {
-    if (node->children.empty())
+    board.makeMove(move.from, move.to, move.promoteTo, undo);
+    path.push_back(board.hash());
+    const int score = searchMove(board, eval, depth - 1, alpha, beta, 1, first);
+    path.pop_back();
+    board.unmakeMove(move.from, move.to, undo);
+    if (aborted)
+      return false;
+    first = false;
+    if (score > bestValue)
     {
-      return std::tuple<Field, Field, PieceType>(
-          node->origin, node->destination, node->promoteTo);
+      bestValue = score;
+      best = move;
+      if (score > alpha)
+      {
+        alpha = score;
+        if (alpha >= beta)
+          break;
+      }
     }
   } // for
+  // Keep the best move for the next window, even if all moves failed low.
+  if (!best.empty())
+    table.store(board.hash(), depth, Bound::none, 0, best);
+  return true;
+}
+
+int Search::searchMove(Board& board, const Evaluator& eval, const unsigned int depth, const int alpha, const int beta, const unsigned int ply, const bool first)
+{
+  // Principal variation search: The first move is most likely the best one
+  // due to the move ordering, so it gets the full window. All other moves are
+  // only searched with a null window to prove that they are not better than
+  // that. Only if that fails, the move is searched again with the full window.
+  if (first)
+    return -negamax(board, eval, depth, -beta, -alpha, ply);
+  int score = -negamax(board, eval, depth, -alpha - 1, -alpha, ply);
+  if ((score > alpha) && (score < beta) && !aborted)
+    score = -negamax(board, eval, depth, -beta, -alpha, ply);
+  return score;
+}
+
+void Search::updatePrincipalVariation(const Move& best)
+{
+  pv.clear();
+  if (best.empty())
+    return;
+  pv.push_back(best);
+  // Follow the moves stored in the transposition table. Entries may have been
+  // overwritten in the meantime, so every move has to be checked, and
+  // repeated positions end the variation, because they would loop forever.
+  Board board(rootBoard);
+  UndoRecord undo;
+  std::vector<std::uint64_t> visited = { board.hash() };
+  board.makeMove(best.from, best.to, best.promoteTo, undo);
+  while (pv.size() < searchDepth)
+  {
+    if (std::find(visited.begin(), visited.end(), board.hash()) != visited.end())
+      break;
+    visited.push_back(board.hash());
+    TranspositionTable::Entry entry;
+    if (!table.probe(board.hash(), entry) || entry.move.empty())
+      break;
+    MoveList moves;
+    Moves::generate(board, moves);
+    if (std::find(moves.begin(), moves.end(), entry.move) == moves.end())
+      break;
+    pv.push_back(entry.move);
+    board.makeMove(entry.move.from, entry.move.to, entry.move.promoteTo, undo);
+  } // while
+}
+
+std::uint64_t Search::totalNodes() const
+{
+  std::uint64_t total = nodeCount;
+  for (const auto& helper : helpers)
+  {
+    total += helper->publishedNodes.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+void Search::sendInfo(const bool completed)
+{
+  SearchInfo info;
+  info.completed = completed;
+  info.depth = completed ? searchDepth : searchDepth + 1;
+  info.selectiveDepth = selectiveDepth;
+  info.nodes = totalNodes();
+  info.time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+  info.hashfull = table.hashfull();
+  if (completed)
+  {
+    info.score = bestScore;
+    info.pv = pv;
+  }
+  infoCallback(info);
+}
+
+int Search::negamax(Board& board, const Evaluator& eval, const unsigned int depth, int alpha, const int beta, const unsigned int ply, const bool nullMoveAllowed)
+{
+  // Draws end the game, so there is nothing to search.
+  if (isDraw(board))
+  {
+    ++nodeCount;
+    return 0;
+  }
+  if (depth == 0)
+  {
+    return quiescence(board, eval, alpha, beta, ply, true);
+  }
+
+  ++nodeCount;
+  if (timeIsUp())
+    return 0;
+  selectiveDepth = std::max(selectiveDepth, ply);
 
-  // Search for move with worst possible best reply of opponent.
-  std::map<std::size_t, int> idxWithScore;
-  for (std::size_t i = 0; i < root.children.size(); ++i)
+  // Results of earlier visits of the same position may make a search of this
+  // position unnecessary, or at least give a good first move to try.
+  const int originalAlpha = alpha;
+  TranspositionTable::Entry entry;
+  const bool found = table.probe(board.hash(), entry);
+  if (found && (entry.depth >= depth))
   {
-    // Use first possible reply as initial value. (At least one reply must
-    // exist, because otherwise it would have been handled by the first search
-    // for checkmate.)
-    idxWithScore[i] = root.children[i]->children[0]->score;
-    // Loop through remaining replies. First reply (index 0) can be omitted.
-    for (std::size_t j = 1; j < root.children[i]->children.size(); ++j)
+    const int stored = scoreFromTable(entry.score, ply);
+    if ((entry.bound == Bound::exact)
+        || ((entry.bound == Bound::lower) && (stored >= beta))
+        || ((entry.bound == Bound::upper) && (stored <= alpha)))
+      return stored;
+  }
+
+  // Selective search: Positions outside of the principal variation that are
+  // clearly better or worse than the window are not searched to full depth.
+  // Mate scores must not be cut off that way, and a player in check has to
+  // get out of check first.
+  const bool inCheck = board.isInCheck(board.toMove());
+  const bool pvNode = beta - alpha > 1;
+  const bool selective = !pvNode && !inCheck && (std::abs(beta) < mateScore - 1000);
+  const int staticScore = selective ? relativeScore(board, eval) : 0;
+
+  // Razoring: If the position is far below alpha near the leaves, then only
+  // captures can save it, so the quiescence search decides.
+  if (selective && searchOptions.razoring && (depth <= frontierDepth)
+      && (staticScore + razoringMargin[depth - 1] <= alpha))
+  {
+    const int score = quiescence(board, eval, alpha, beta, ply, true);
+    if (aborted || (score <= alpha))
+      return score;
+  }
+
+  // Null move pruning: If the position is still above beta when the
+  // opponent may move twice in a row, then a real move will be above beta,
+  // too. That does not hold in zugzwang, where every move makes the position
+  // worse. Zugzwang is not possible without pieces, and it is rare with more
+  // than a few pieces. For the few pieces in between, a reduced search
+  // without null move verifies the cut-off.
+  const unsigned int pieces = nonPawnPieces(board, board.toMove());
+  if (selective && searchOptions.nullMovePruning && nullMoveAllowed
+      && (depth >= nullMoveMinDepth) && (pieces > 0) && (staticScore >= beta))
+  {
+    const unsigned int reduction = depth > 6 ? 3 : 2;
+    const unsigned int reducedDepth = depth > reduction ? depth - 1 - reduction : 0;
+    UndoRecord undo;
+    board.makeNullMove(undo);
+    // Repeating a position from before the null move is no real repetition.
+    const std::size_t previousStart = repetitionStart;
+    path.push_back(board.hash());
+    repetitionStart = path.size() - 1;
+    int score = -negamax(board, eval, reducedDepth, -beta, -beta + 1, ply + 1, false);
+    repetitionStart = previousStart;
+    path.pop_back();
+    board.unmakeNullMove(undo);
+    if (aborted)
+      return 0;
+    if (score >= beta)
     {
-      if (root.board.toMove() == Colour::black)
+      // Mates found after a null move are not real.
+      if (score >= mateScore - 1000)
+        score = beta;
+      if (pieces > nullMoveVerificationPieces)
+        return score;
+      const int verified = negamax(board, eval, depth - reduction, beta - 1, beta, ply, false);
+      if (aborted)
+        return 0;
+      if (verified >= beta)
+        return score;
+    }
+  }
+
+  MoveList moves;
+  Moves::generate(board, moves);
+  if (moves.empty())
+  {
+    // No moves: Either the player is checkmate or it is a stalemate.
+    if (inCheck)
+      return -mateScore + static_cast<int>(ply);
+    return 0;
+  }
+  ordering.order(board, moves, found ? entry.move : Move(), ply);
+
+  // Futility pruning: Quiet moves near the leaves will not change the static
+  // evaluation a lot. If it is far below alpha, they are not searched.
+  const bool futile = selective && searchOptions.futilityPruning
+      && (depth <= frontierDepth)
+      && (staticScore + futilityMargin * static_cast<int>(depth) <= alpha);
+
+  int best = -infinity;
+  Move bestMove;
+  UndoRecord undo;
+  unsigned int index = 0;
+  for (const Move& move : moves)
+  {
+    const bool quiet = !MoveOrdering::isTactical(board, move)
+                    && !ordering.isKiller(move, ply);
+    board.makeMove(move.from, move.to, move.promoteTo, undo);
+    path.push_back(board.hash());
+    const bool givesCheck = board.isInCheck(board.toMove());
+    int score = 0;
+    if (futile && (index > 0) && quiet && !givesCheck)
+    {
+      path.pop_back();
+      board.unmakeMove(move.from, move.to, undo);
+      // The move is assumed to be at most as good as the margin allows.
+      best = std::max(best, staticScore + futilityMargin * static_cast<int>(depth));
+      ++index;
+      continue;
+    }
+    // Late move reductions: Quiet moves that come late in the move ordering
+    // rarely are the best move, so search them with less depth first. If one
+    // of them gets above alpha nevertheless, search it again normally.
+    bool reduced = false;
+    if (searchOptions.lateMoveReductions && (depth >= reductionMinDepth)
+        && (index >= reductionMinMoves) && quiet && !inCheck && !givesCheck)
+    {
+      unsigned int reduction = 1;
+      if (index >= 2 * reductionMinMoves)
+        ++reduction;
+      if (depth >= 6)
+        ++reduction;
+      if (pvNode)
+        --reduction;
+      reduction = std::min(reduction, depth - 2);
+      if (reduction > 0)
       {
-        // Engine plays black. That means best score for white is max. score.
-        if (root.children[i]->children[j]->score > idxWithScore[i])
-        {
-          idxWithScore[i] = root.children[i]->children[j]->score;
-        }
-      } // if
-      else
+        reduced = true;
+        score = -negamax(board, eval, depth - 1 - reduction, -alpha - 1, -alpha, ply + 1);
+        if ((score > alpha) && !aborted)
+          reduced = false;
+      }
+    }
+    if (!reduced)
+      score = searchMove(board, eval, depth - 1, alpha, beta, ply + 1, index == 0);
+    path.pop_back();
+    board.unmakeMove(move.from, move.to, undo);
+    if (aborted)
+      return 0;
+    ++index;
+    if (score > best)
+    {
+      best = score;
+      bestMove = move;
+      if (score > alpha)
       {
-        // Engine plays white. That means best score for black is min. score.
-        if (root.children[i]->children[j]->score < idxWithScore[i])
+        alpha = score;
+        // Beta cut-off: The opponent will avoid this position, because there
+        // is a better alternative for him/her somewhere else in the tree.
+        if (alpha >= beta)
         {
-          idxWithScore[i] = root.children[i]->children[j]->score;
+          ordering.cutoff(board, move, depth, ply);
+          break;
         }
-      } // else
-    } // for
+      }
+    }
   } // for
 
-  // Find best (for current player).
-  std::size_t bestIdx = 0;
-  if (root.board.toMove() == Colour::black)
+  Bound bound = Bound::exact;
+  if (best >= beta)
+    bound = Bound::lower;
+  else if (best <= originalAlpha)
   {
-    for (std::size_t i = 1; i < root.children.size(); ++i)
+    // All moves failed low, so none of them is known to be the best one.
+    bound = Bound::upper;
+    bestMove = Move();
+  }
+  table.store(board.hash(), depth, bound, scoreToTable(best, ply), bestMove);
+  return best;
+}
+
+bool Search::isDraw(const Board& board) const
+{
+  // Checkmate takes precedence over the 50 move rule.
+  if ((board.halfmovesFifty() >= 100)
+      && (!board.isInCheck(board.toMove()) || Moves::hasAllowedMove(board, board.toMove())))
+    return true;
+  if (insufficientMaterial(board))
+    return true;
+  // Only positions since the last pawn move or capture can repeat, and only
+  // those with the same player to move, i.e. every second one. The earliest
+  // possible repetition is four plys ago.
+  const std::size_t current = path.size() - 1;
+  const std::size_t reversible = std::min<std::size_t>(board.halfmovesFifty(), current - repetitionStart);
+  for (std::size_t back = 4; back <= reversible; back += 2)
+  {
+    if (path[current - back] == path[current])
+      return true;
+  } // for
+  return false;
+}
+
+int Search::quiescence(Board& board, const Evaluator& eval, int alpha, const int beta, const unsigned int ply, const bool evasions)
+{
+  ++nodeCount;
+  ++quiescenceNodeCount;
+  if (timeIsUp())
+    return 0;
+  selectiveDepth = std::max(selectiveDepth, ply);
+  // Captures may leave too little material for a mate. (They cannot lead to
+  // repetitions or to a draw by the 50 move rule, though.)
+  if (insufficientMaterial(board))
+    return 0;
+  if (ply >= maxPly)
+    return relativeScore(board, eval);
+
+  const bool inCheck = board.isInCheck(board.toMove());
+  const bool searchEvasions = inCheck && evasions;
+  int best = -infinity;
+  MoveList moves;
+  if (searchEvasions)
+  {
+    // Standing pat is not an option when in check, because the check has to
+    // be answered. So all moves have to be searched.
+    Moves::generate(board, moves);
+    if (moves.empty())
+      return -mateScore + static_cast<int>(ply);
+    ordering.order(board, moves, Move(), ply);
+  }
+  else
+  {
+    // Later plys do not search the evasions, but checkmate is still checkmate.
+    if (inCheck && !Moves::hasAllowedMove(board, board.toMove()))
+      return -mateScore + static_cast<int>(ply);
+    // The player to move may "stand pat", i.e. keep the static evaluation of
+    // the position instead of capturing.
+    best = relativeScore(board, eval);
+    if (best >= beta)
+      return best;
+    alpha = std::max(alpha, best);
+    Moves::generateCaptures(board, moves);
+    // Captures that lose material in the exchange will hardly improve the
+    // position, so they are not searched at all. Evasions are all searched,
+    // because they are the only moves the player has.
+    MoveOrdering::orderCaptures(board, moves);
+  }
+
+  UndoRecord undo;
+  for (const Move& move : moves)
+  {
+    board.makeMove(move.from, move.to, move.promoteTo, undo);
+    const int score = -quiescence(board, eval, -beta, -alpha, ply + 1, false);
+    board.unmakeMove(move.from, move.to, undo);
+    if (aborted)
+      return 0;
+    if (score > best)
     {
-      if (idxWithScore[i] < idxWithScore[bestIdx])
+      best = score;
+      if (score > alpha)
       {
-        bestIdx = i;
+        alpha = score;
+        if (alpha >= beta)
+          break;
       }
     }
-  } // if
-  else // player == white
+  } // for
+  return best;
+}
+
+bool Search::timeIsUp()
+{
+  // Look at the clock every 1024 nodes only, because getting the time is
+  // expensive compared to the other work done per node. The node count is
+  // published for other threads at the same interval, so that there are no
+  // atomic operations per node.
+  if ((nodeCount & 1023) == 0)
   {
-    for (std::size_t i = 1; i < root.children.size(); ++i)
+    publishedNodes.store(nodeCount, std::memory_order_relaxed);
+    if (useDeadline || infoCallback || pondering)
     {
-      if (idxWithScore[i] > idxWithScore[bestIdx])
+      const auto now = std::chrono::steady_clock::now();
+      checkPonderHit(now);
+      if (useDeadline && (now >= deadline))
+      {
+        aborted = true;
+      }
+      if (infoCallback && (now - lastInfo >= std::chrono::seconds(1)))
       {
-        bestIdx = i;
+        lastInfo = now;
+        sendInfo(false);
       }
     }
-  } // else
-  return std::tuple<Field, Field, PieceType>(
-          root.children[bestIdx]->origin, root.children[bestIdx]->destination,
-          root.children[bestIdx]->promoteTo);
+  }
+  if (useDeadline && (nodeLimit != 0) && (nodeCount >= nodeLimit))
+  {
+    aborted = true;
+  }
+  if (useDeadline && (stopSignal != nullptr)
+      && stopSignal->load(std::memory_order_relaxed))
+  {
+    aborted = true;
+  }
+  return aborted;
+}
+
+std::tuple<Field, Field, PieceType> Search::bestMove() const
+{
+  return std::tuple<Field, Field, PieceType>(bestOrigin, bestDestination, bestPromotion);
 }
 
-const Node& Search::rootNode() const
+int Search::score() const
 {
-  return root;
+  return bestScore;
 }
 
 unsigned int Search::depth() const
@@ -171,71 +829,115 @@ unsigned int Search::depth() const
   return searchDepth;
 }
 
-bool Search::hasMove() const
+std::uint64_t Search::nodes() const
 {
-  return !root.children.empty();
+  return nodeCount;
 }
 
-std::tuple<Field, Field, PieceType> Search::search(const Board& board, const Evaluator& eval, const unsigned int depth)
+std::uint64_t Search::quiescenceNodes() const
 {
-  Search s(board);
-  s.search(eval, depth);
-  return s.bestMove();
+  return quiescenceNodeCount;
 }
 
-void Search::expandNode(Node& node, const Evaluator& eval, const unsigned int depth)
+const MoveOrdering& Search::moveOrdering() const
 {
-  if (depth <= 0)
-  {
-    return;
-  }
-  for (int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
+  return ordering;
+}
+
+void Search::setMoveOrdering(const MoveOrdering& data)
+{
+  ordering = data;
+}
+
+void Search::usePredictedVariation(const std::vector<Move>& moves)
+{
+  Board board(rootBoard);
+  UndoRecord undo;
+  for (const Move& move : moves)
   {
-    const Piece elem = node.board.element(static_cast<Field>(i));
-    if ((elem.colour() != node.board.toMove()) || (elem.piece() == PieceType::none))
-      continue;
-    // check possible moves
-    for (int j = static_cast<int>(Field::a1); j <= static_cast<int>(Field::h8); ++j)
+    MoveList legal;
+    Moves::generate(board, legal);
+    if (std::find(legal.begin(), legal.end(), move) == legal.end())
+      break;
+    TranspositionTable::Entry entry;
+    if (!table.probe(board.hash(), entry) || entry.move.empty())
     {
-      const Field from = static_cast<Field>(i);
-      const Field to = static_cast<Field>(j);
-      if (!Moves::isAllowed(node.board, from, to))
-      {
-        continue;
-      }
-      // Default: Not a pawn promotion.
-      if (!Moves::isPromotion(node.board, from, to))
-      {
-        Board movedBoard(node.board);
-        movedBoard.move(from, to, PieceType::queen);
-        node.children.push_back(
-            std::unique_ptr<Node>(
-            new Node(movedBoard, from, to, PieceType::queen,
-            eval.score(movedBoard))));
-      } // if not pawn promotion
-      else
-      {
-        // Same move but with different promotions.
-        const auto types = { PieceType::queen, PieceType::knight, PieceType::bishop, PieceType::rook };
-        for ( const auto promo : types )
-        {
-          Board movedBoard(node.board);
-          movedBoard.move(from, to, promo);
-          node.children.push_back(
-              std::unique_ptr<Node>(
-              new Node(movedBoard, from, to, promo,
-              eval.score(movedBoard))));
-        } // for
-      } // else (It's a pawn promotion.)
-    } // for j
-  } // for i
-  // sort children
-  node.sortChildren();
-  // expand child nodes
-  for(auto& child : node.children)
-  {
-    expandNode(*child, eval, depth - 1);
+      // Depth zero and no bound: The entry only provides the move.
+      table.store(board.hash(), 0, Bound::none, 0, move);
+    }
+    board.makeMove(move.from, move.to, move.promoteTo, undo);
   } // for
 }
 
+const std::vector<Move>& Search::principalVariation() const
+{
+  return pv;
+}
+
+unsigned int Search::threads() const
+{
+  return threadCount;
+}
+
+void Search::setThreads(const unsigned int count)
+{
+  threadCount = std::clamp(count, 1u, maxThreads);
+}
+
+void Search::setGameHistory(const std::vector<std::uint64_t>& hashes)
+{
+  gameHistory = hashes;
+}
+
+const SearchOptions& Search::options() const
+{
+  return searchOptions;
+}
+
+void Search::setOptions(const SearchOptions& opts)
+{
+  searchOptions = opts;
+}
+
+void Search::setStopSignal(const std::atomic<bool>& stop)
+{
+  stopSignal = &stop;
+}
+
+void Search::setPonderSignal(const std::atomic<bool>& pondering)
+{
+  ponderSignal = &pondering;
+}
+
+void Search::checkPonderHit(const std::chrono::steady_clock::time_point now)
+{
+  if (!pondering || ponderSignal->load(std::memory_order_relaxed))
+    return;
+  // Ponder hit: The search goes on, but now the clock is running.
+  pondering = false;
+  limitStart = now;
+  if (hardTimeLimit.has_value())
+  {
+    deadline = now + hardTimeLimit.value();
+  }
+}
+
+void Search::setInfoCallback(std::function<void(const SearchInfo&)> callback)
+{
+  infoCallback = std::move(callback);
+}
+
+bool Search::hasMove() const
+{
+  return bestOrigin != Field::none;
+}
+
+std::tuple<Field, Field, PieceType> Search::search(const Board& board, const Evaluator& eval, const unsigned int depth, const SearchOptions& opts)
+{
+  Search s(board);
+  s.setOptions(opts);
+  s.search(eval, depth);
+  return s.bestMove();
+}
+
 } // namespace
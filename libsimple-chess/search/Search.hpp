@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of simple-chess.
-    Copyright (C) 2017  Dirk Stolle
+    Copyright (C) 2017, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,10 +21,21 @@
 #ifndef SIMPLE_CHESS_SEARCH_HPP
 #define SIMPLE_CHESS_SEARCH_HPP
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
 #include <tuple>
+#include <vector>
 #include "../data/Board.hpp"
 #include "../evaluation/Evaluator.hpp"
-#include "Node.hpp"
+#include "MoveOrdering.hpp"
+#include "SearchInfo.hpp"
+#include "SearchLimits.hpp"
+#include "SearchOptions.hpp"
+#include "TranspositionTable.hpp"
 
 namespace simplechess
 {
@@ -36,19 +47,176 @@ class Search
     /** \brief Constructor.
      *
      * \param board the current position
+     * \remarks The search uses its own transposition table of the default size.
      */
     Search(const Board& board);
 
 
+    /** \brief Constructor with a shared transposition table.
+     *
+     * \param board the current position
+     * \param table transposition table to use during the search; must live
+     *              at least as long as this instance
+     * \remarks Entries of the table are kept between searches, so results of
+     *          previous searches can be reused.
+     */
+    Search(const Board& board, TranspositionTable& table);
+
+
     /** \brief Searches for the best move from the current position.
      *
      * \param eval evaluator for positions
-     * \param depth search depth
+     * \param depth search depth in plys / half moves
      * \remarks Call bestMove() afterwards to get the best move from the search.
+     *          The search is a depth-first alpha-beta search, which stores
+     *          the results of searched positions in a transposition table.
      */
     void search(const Evaluator& eval, const unsigned int depth);
 
 
+    /** \brief Searches for the best move with iterative deepening until the
+     *         given time is used up.
+     *
+     * \param eval       evaluator for positions
+     * \param maxDepth   maximum search depth in plys / half moves
+     * \param timeLimit  time that the search may take
+     * \remarks The search is repeated with depth 1, 2, 3, ... until either the
+     *          maximum depth is reached or the time is up. An iteration that
+     *          has not been completed in time is discarded, so bestMove()
+     *          returns the best move of the last completed iteration. The
+     *          first iteration is always completed, even if the time limit is
+     *          exceeded, so that there is a move whenever the player can move.
+     *          If more than one thread is set via setThreads(), then helper
+     *          threads search the same position at the same time (Lazy SMP).
+     *          They share the transposition table with the main search, so
+     *          their results speed up the main search.
+     *          This is the same as a search with a soft time limit of half
+     *          the given time and a hard time limit of the given time.
+     */
+    void search(const Evaluator& eval, const unsigned int maxDepth, const std::chrono::milliseconds& timeLimit);
+
+
+    /** \brief Searches for the best move with iterative deepening within the
+     *         given limits.
+     *
+     * \param eval    evaluator for positions
+     * \param limits  limits for depth, nodes and time of the search
+     * \remarks The search is repeated with depth 1, 2, 3, ... until the
+     *          maximum depth is reached, a soft limit is reached after an
+     *          iteration, or a hard limit aborts the current iteration. An
+     *          aborted iteration is discarded, so bestMove() returns the best
+     *          move of the last completed iteration. The first iteration is
+     *          always completed. Without any time limits, the search only
+     *          ends at the maximum depth, at the node limit or when the stop
+     *          signal is set.
+     */
+    void search(const Evaluator& eval, const SearchLimits& limits);
+
+
+    /** \brief Gets the number of threads used by searches with time limit.
+     *
+     * \return Returns the number of threads, including the main thread.
+     */
+    unsigned int threads() const;
+
+
+    /** \brief Sets the number of threads for searches with time limit.
+     *
+     * \param count  number of threads, including the main thread; will be
+     *               clamped to the range [1;maxThreads]
+     */
+    void setThreads(const unsigned int count);
+
+
+    /** \brief Sets the positions of the game that came before the position
+     *         to search, so that the search can detect repetitions.
+     *
+     * \param hashes  hashes of the previous positions, oldest first; the
+     *                position to search itself is not part of it
+     * \remarks Positions before the last pawn move or capture are never
+     *          looked at, so they may be left out.
+     */
+    void setGameHistory(const std::vector<std::uint64_t>& hashes);
+
+
+    /** \brief Gets the switches for the selective parts of the search.
+     *
+     * \return Returns the search options.
+     */
+    const SearchOptions& options() const;
+
+
+    /** \brief Sets the switches for the selective parts of the search.
+     *
+     * \param opts  the new search options
+     */
+    void setOptions(const SearchOptions& opts);
+
+
+    /** \brief Sets a flag that stops searches with time limit when it is set.
+     *
+     * \param stop  the stop flag; has to live longer than the search
+     * \remarks The flag may be set from another thread at any time. The
+     *          search then finishes as soon as possible, like it does when the
+     *          time is up. The first iteration is still completed, so there is
+     *          a move, if the player can move.
+     */
+    void setStopSignal(const std::atomic<bool>& stop);
+
+
+    /** \brief Sets a flag that tells whether the search is pondering, i.e.
+     *         searching on the opponent's time.
+     *
+     * \param pondering  the ponder flag; has to live longer than the search
+     * \remarks As long as the flag is set, the time limits of searches with
+     *          time limit do not apply. When the flag is cleared by another
+     *          thread (ponder hit), the search continues without losing its
+     *          work, and the time limits are measured from that moment on.
+     */
+    void setPonderSignal(const std::atomic<bool>& pondering);
+
+
+    /** \brief Sets a function that receives statistics about searches with
+     *         iterative deepening.
+     *
+     * \param callback  the function to call; an empty function disables it
+     * \remarks The function is called by the thread that runs the search,
+     *          once after each completed iteration and about once per second
+     *          during an iteration.
+     */
+    void setInfoCallback(std::function<void(const SearchInfo&)> callback);
+
+
+    /** \brief Gets the killer moves and history values of the search.
+     *
+     * \return Returns the move ordering data, e.g. to pass it to the search
+     *         of the next move via setMoveOrdering().
+     */
+    const MoveOrdering& moveOrdering() const;
+
+
+    /** \brief Sets the killer moves and history values for the next searches.
+     *
+     * \param data  move ordering data of an earlier search
+     * \remarks The data is kept between searches of the same instance, it is
+     *          only replaced by this method.
+     */
+    void setMoveOrdering(const MoveOrdering& data);
+
+
+    /** \brief Stores a predicted line of play from the current position in
+     *         the transposition table, so that the search tries these moves
+     *         first.
+     *
+     * \param moves  the predicted moves, starting in the current position,
+     *               e.g. the rest of the principal variation of the search
+     *               two plys earlier
+     * \remarks Illegal moves end the line. Positions for which the table
+     *          already has a best move keep their entry.
+     */
+    void usePredictedVariation(const std::vector<Move>& moves);
+
+
     /** \brief Checks whether the search result (if any) has a possible move.
      *
      * \return Returns true, if there is a move. Returns false otherwise.
@@ -65,58 +233,317 @@ class Search
     std::tuple<Field, Field, PieceType> bestMove() const;
 
 
-    /** \brief Gets the root node of the search.
+    /** \brief Gets the score of the best move.
      *
-     * \return Returns a constant reference to the root node of the search tree.
+     * \return Returns the score of the best move in centipawns, as seen from
+     *         the player who is to move in the searched position. That means
+     *         positive values are good for the player to move, negative values
+     *         are bad.
      */
-    const Node& rootNode() const;
+    int score() const;
 
 
     /** \brief Gets the depth of the last search in number of plys / half moves.
      *
      * \return Returns the depth of the last search, or zero if no search has
-     *         been performed by this instance yet.
+     *         been performed by this instance yet. For searches with time
+     *         limit this is the depth of the last completed iteration.
      */
     unsigned int depth() const;
 
 
+    /** \brief Gets the number of positions that were visited during the last search.
+     *
+     * \return Returns the number of nodes of the last search.
+     */
+    std::uint64_t nodes() const;
+
+
+    /** \brief Gets the number of positions that were visited by the quiescence
+     *         search during the last search.
+     *
+     * \return Returns the number of quiescence nodes of the last search.
+     * \remarks These nodes are included in the value returned by nodes().
+     */
+    std::uint64_t quiescenceNodes() const;
+
+
+    /** \brief Gets the principal variation of the last search, i.e. the
+     *         expected sequence of moves, starting with the best move.
+     *
+     * \return Returns the principal variation. The vector is empty, if there
+     *         is no best move.
+     * \remarks The moves after the best move are taken from the transposition
+     *          table, so the variation may be shorter than the search depth.
+     */
+    const std::vector<Move>& principalVariation() const;
+
+
     /** \brief Searches for the best next move on the given board.
      *
      * \param board the current position
      * \param eval evaluator for positions
      * \param depth search depth
+     * \param opts  switches for the selective parts of the search
      * \return Returns a tuple (origin, destination, promotion type) indicating the best move.
      *         Returns (Field::none, Field::none, PieceType::none) if there is no best move.
      */
-    static std::tuple<Field, Field, PieceType> search(const Board& board, const Evaluator& eval, const unsigned int depth);
+    static std::tuple<Field, Field, PieceType> search(const Board& board, const Evaluator& eval, const unsigned int depth, const SearchOptions& opts = SearchOptions());
+
+
+    /** Score of a position where the player to move is checkmate. The score
+        has to be higher than anything an evaluator can return, including the
+        bonus of the CheckEvaluator for a checkmate. Mates that are found
+        closer to the root get a slightly better score, so that the search
+        prefers shorter mates. */
+    static constexpr int mateScore = 100000000;
+
+
+    /** Score that is larger than any real score of a position. */
+    static constexpr int infinity = mateScore + 1000;
+
+
+    /** Maximum number of search threads. */
+    static constexpr unsigned int maxThreads = 256;
+
+
+    /** Initial half width of the aspiration window in centipawns. */
+    static constexpr int aspirationWindow = 100;
+
+
+    /** Half width of the aspiration window from which on the full window is
+        used instead. */
+    static constexpr int aspirationMaxWindow = 1000;
+
+
+    /** Minimum search depth in plys for which aspiration windows are used.
+        The first iterations are fast anyway, and their scores vary more. */
+    static constexpr unsigned int aspirationMinDepth = 4;
   private:
-    /** \brief Creates child nodes for a given node.
+    /** \brief Resets the search result and the node count. */
+    void reset();
+
+
+    /** \brief Runs the iterative deepening of a helper thread.
      *
-     * \param node current node that will be expanded
-     * \param eval evaluator for positions
-     * \param depth search depth
+     * \param eval      evaluator for positions
+     * \param maxDepth  maximum search depth in plys
+     * \param index     index of the helper thread, starting at one
+     * \remarks Every second helper starts one ply deeper than the main
+     *          search, so that the threads do not all search the same nodes
+     *          at the same time. The helper stops at the deadline or when the
+     *          main search sets the stop flag.
      */
-    static void expandNode(Node& node, const Evaluator& eval, const unsigned int depth);
+    void helperSearch(const Evaluator& eval, const unsigned int maxDepth, const unsigned int index);
 
 
-    /** \brief Gets the best move (if any moves are available) for a one ply search.
+    /** \brief Searches the root position to a given depth.
      *
-     * \return Returns a tuple (origin, destination, promotion type) indicating the best move.
-     *         Returns (Field::none, Field::none, PieceType::none) if there is no best move.
+     * \param eval   evaluator for positions
+     * \param depth  search depth in plys, must not be zero
+     * \return Returns true, if the search was completed. Returns false, if
+     *         the search has been aborted because the time was up. The best
+     *         move and score are only updated for a completed search.
      */
-    std::tuple<Field, Field, PieceType> bestMoveOnePly() const;
+    bool searchRoot(const Evaluator& eval, const unsigned int depth);
 
 
-    /** \brief Gets the best move (if any moves are available) for a two ply search.
+    /** \brief Searches all moves of the root position with the given window.
      *
-     * \return Returns a tuple (origin, destination, promotion type) indicating the best move.
-     *         Returns (Field::none, Field::none, PieceType::none) if there is no best move.
+     * \param eval       evaluator for positions
+     * \param depth      search depth in plys, must not be zero
+     * \param alpha      lower bound of the search window
+     * \param beta       upper bound of the search window
+     * \param best       receives the best move
+     * \param bestValue  receives the score of the best move - a value at or
+     *                   below alpha or at or above beta is only a bound
+     * \return Returns true, if the search was completed. Returns false, if
+     *         the search has been aborted because the time was up.
+     */
+    bool searchRootWindow(const Evaluator& eval, const unsigned int depth, int alpha, const int beta, Move& best, int& bestValue);
+
+
+    /** \brief Searches the position after a move as part of a principal
+     *         variation search.
+     *
+     * \param board  the position after the move
+     * \param eval   evaluator for positions
+     * \param depth  remaining search depth in plys
+     * \param alpha  lower bound of the search window of the parent position
+     * \param beta   upper bound of the search window of the parent position
+     * \param ply    distance of the position to the root position in plys
+     * \param first  whether it is the first move searched in the parent
+     *               position - only the first move gets the full window
+     * \return Returns the score of the move as seen from the player who made
+     *         the move.
+     */
+    int searchMove(Board& board, const Evaluator& eval, const unsigned int depth, const int alpha, const int beta, const unsigned int ply, const bool first);
+
+
+    /** \brief Checks whether the current position of the search is a draw
+     *         due to repetition, the 50 move rule or insufficient material.
+     *
+     * \param board  the current position, its hash has to be the last entry
+     *               of the search path
+     * \return Returns true, if the position is a draw. Returns false otherwise.
+     * \remarks Any repetition counts as draw, even if the position has only
+     *          occurred twice: If repeating it was the best option once, then
+     *          it will be the best option again.
      */
-    std::tuple<Field, Field, PieceType> bestMoveTwoPly() const;
+    bool isDraw(const Board& board) const;
+
+
+    /** \brief Sets the principal variation, starting with the given move and
+     *         following the moves of the transposition table.
+     *
+     * \param best  the best move in the root position
+     */
+    void updatePrincipalVariation(const Move& best);
+
+
+    /** \brief Gets the number of nodes of the main search and of all helper
+     *         threads that are currently running.
+     *
+     * \return Returns the total number of nodes.
+     * \remarks The node counts of helpers are only published every 1024
+     *          nodes, so the value is a little bit lower than the exact count.
+     */
+    std::uint64_t totalNodes() const;
+
+
+    /** \brief Checks whether a ponder hit has happened since the last call,
+     *         and if so, starts the time limits.
+     *
+     * \param now  the current time
+     */
+    void checkPonderHit(const std::chrono::steady_clock::time_point now);
+
+
+    /** \brief Sends the current search statistics to the info callback.
+     *
+     * \param completed  whether an iteration has just been completed
+     */
+    void sendInfo(const bool completed);
+
+
+    /** \brief Searches a position with the negamax variant of the alpha-beta algorithm.
+     *
+     * \param board  the position to search - will be changed during the
+     *               search, but is restored to its original state afterwards
+     * \param eval   evaluator for positions
+     * \param depth  remaining search depth in plys
+     * \param alpha  lower bound of the search window
+     * \param beta   upper bound of the search window
+     * \param ply    distance to the root position in plys
+     * \param nullMoveAllowed  whether null move pruning may be tried in this
+     *                         position - it is not allowed directly after
+     *                         another null move or in its verification search
+     * \return Returns the score of the position as seen from the player who
+     *         is to move on the given board.
+     */
+    int negamax(Board& board, const Evaluator& eval, const unsigned int depth, int alpha, const int beta, const unsigned int ply, const bool nullMoveAllowed = true);
+
+
+    /** \brief Searches captures and promotions of a position until a quiet
+     *         position is reached.
+     *
+     * \param board  the position to search - will be changed during the
+     *               search, but is restored to its original state afterwards
+     * \param eval   evaluator for positions
+     * \param alpha  lower bound of the search window
+     * \param beta   upper bound of the search window
+     * \param ply    distance to the root position in plys
+     * \param evasions  whether all moves are searched when the player to move
+     *                  is in check, i.e. at the first ply of the quiescence search
+     * \return Returns the score of the position as seen from the player who
+     *         is to move on the given board.
+     * \remarks The player to move may "stand pat", i.e. keep the static
+     *          evaluation of the position instead of capturing. A player in
+     *          check can only do that on later plys, because searching all
+     *          check evasions on every ply lets the quiescence search explode
+     *          in tactical positions. Checkmate is recognized on all plys.
+     */
+    int quiescence(Board& board, const Evaluator& eval, int alpha, const int beta, const unsigned int ply, const bool evasions);
+
+
+    /** \brief Checks whether the time for the search is up or whether the
+     *         search has been stopped, and sets the aborted flag, if so.
+     *
+     * \return Returns true, if the search has to be aborted.
+     */
+    bool timeIsUp();
+
+
+    /** Maximum distance to the root position in plys. The quiescence search
+        stops there, even if the position is not quiet yet. */
+    static constexpr unsigned int maxPly = 128;
+
+
+    /** Minimum remaining depth in plys for null move pruning. */
+    static constexpr unsigned int nullMoveMinDepth = 3;
+
+
+    /** Largest number of non-pawn pieces of the player to move for which a
+        null move cut-off is verified by a reduced search. Zugzwang is common
+        with so little material. */
+    static constexpr unsigned int nullMoveVerificationPieces = 2;
+
+
+    /** Minimum remaining depth in plys for late move reductions. */
+    static constexpr unsigned int reductionMinDepth = 3;
+
+
+    /** Number of moves that are searched with full depth before the late
+        move reductions start. */
+    static constexpr unsigned int reductionMinMoves = 3;
+
+
+    /** Maximum remaining depth in plys for futility pruning and razoring. */
+    static constexpr unsigned int frontierDepth = 2;
+
+
+    /** Futility margin per ply of remaining depth in centipawns. */
+    static constexpr int futilityMargin = 150;
+
+
+    /** Razoring margins in centipawns for one and two plys of remaining
+        depth. */
+    static constexpr int razoringMargin[frontierDepth] = { 300, 500 };
 
 
-    Node root; /**< root node of search for the current starting position */
+    std::unique_ptr<TranspositionTable> ownTable; /**< table owned by the search, if no table was given to the constructor */
+    TranspositionTable& table; /**< transposition table used by the search */
+    MoveOrdering ordering; /**< killer moves and history for move ordering */
+    SearchOptions searchOptions; /**< switches for the selective parts of the search */
+    Board rootBoard; /**< board of the starting position of the search */
+    Field bestOrigin; /**< origin field of the best move */
+    Field bestDestination; /**< destination field of the best move */
+    PieceType bestPromotion; /**< promotion piece type of the best move */
+    int bestScore; /**< score of the best move */
     unsigned int searchDepth; /**< depth of last search in plys / half moves */
+    std::uint64_t nodeCount; /**< number of nodes visited during last search */
+    std::uint64_t quiescenceNodeCount; /**< number of quiescence search nodes visited during last search */
+    bool useDeadline; /**< whether the search has to stop at the deadline */
+    std::chrono::steady_clock::time_point deadline; /**< time when the search has to stop */
+    std::uint64_t nodeLimit; /**< maximum number of nodes; zero means no limit */
+    bool aborted; /**< whether the current iteration has been aborted */
+    unsigned int threadCount; /**< number of threads for searches with time limit */
+    std::atomic<bool> stopHelpers; /**< signals helper threads to stop */
+    const std::atomic<bool>* stopSignal; /**< external stop flag, or stop flag of the main search for helpers; may be null */
+    std::vector<std::unique_ptr<Search>> helpers; /**< helper searches of the running multi-threaded search */
+    std::atomic<std::uint64_t> publishedNodes; /**< copy of nodeCount for other threads, updated every 1024 nodes */
+    unsigned int selectiveDepth; /**< largest distance to the root during the last search */
+    std::vector<Move> pv; /**< principal variation of the last completed iteration */
+    std::vector<std::uint64_t> gameHistory; /**< hashes of the positions before the root position */
+    std::vector<std::uint64_t> path; /**< hashes of the game history, the root position and the positions of the current search path */
+    std::size_t repetitionStart; /**< index in path of the first position that may be repeated, e.g. the position after a null move */
+    std::function<void(const SearchInfo&)> infoCallback; /**< receives search statistics; may be empty */
+    std::chrono::steady_clock::time_point startTime; /**< start time of the search */
+    std::chrono::steady_clock::time_point lastInfo; /**< time of the last info for the callback */
+    const std::atomic<bool>* ponderSignal; /**< flag that is set while the search is pondering; may be null */
+    bool pondering; /**< whether the time limits are suspended because of pondering */
+    std::chrono::steady_clock::time_point limitStart; /**< time from which the time limits are measured */
+    std::optional<std::chrono::milliseconds> hardTimeLimit; /**< hard time limit of the current search */
 }; //class
 
 } //namespace
@@ -0,0 +1,68 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_SEARCHINFO_HPP
+#define SIMPLE_CHESS_SEARCHINFO_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "../data/Move.hpp"
+
+namespace simplechess
+{
+
+/** \brief Statistics about a running search, e.g. for the thinking output
+ *         of an engine.
+ */
+struct SearchInfo
+{
+  /** Whether the info belongs to a completed iteration. If not, then it is a
+      periodic update during an iteration, and score and principal variation
+      are not set. */
+  bool completed = false;
+
+  /** Depth of the iteration in plys. */
+  unsigned int depth = 0;
+
+  /** Largest distance to the root that the search has reached so far in plys,
+      including the quiescence search. */
+  unsigned int selectiveDepth = 0;
+
+  /** Score of the best move, as seen from the player to move in the root
+      position. */
+  int score = 0;
+
+  /** Number of nodes searched by all threads so far. */
+  std::uint64_t nodes = 0;
+
+  /** Time since the start of the search. */
+  std::chrono::milliseconds time = std::chrono::milliseconds(0);
+
+  /** Usage of the transposition table in permille. */
+  unsigned int hashfull = 0;
+
+  /** Principal variation, starting with the best move. */
+  std::vector<Move> pv;
+}; // struct
+
+} // namespace
+
+#endif // SIMPLE_CHESS_SEARCHINFO_HPP
@@ -0,0 +1,62 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_SEARCHLIMITS_HPP
+#define SIMPLE_CHESS_SEARCHLIMITS_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace simplechess
+{
+
+/** \brief Limits for a search with iterative deepening.
+ *
+ * Soft limits are only checked between two iterations: If a soft limit is
+ * reached, then no new iteration is started. Hard limits abort the search
+ * in the middle of an iteration. The first iteration is always completed,
+ * so that there is a move whenever the player can move.
+ */
+struct SearchLimits
+{
+  /** Default value for the maximum search depth. */
+  static constexpr unsigned int defaultDepth = 100;
+
+  /** Maximum search depth in plys / half moves. Searches stop after the
+      iteration with this depth. */
+  unsigned int depth = defaultDepth;
+
+  /** Maximum number of nodes of the main search thread (hard limit). Zero
+      means that there is no node limit. */
+  std::uint64_t nodes = 0;
+
+  /** Time after which no new iteration is started (soft limit). No value
+      means that there is no soft time limit. */
+  std::optional<std::chrono::milliseconds> softTime;
+
+  /** Time after which the search is aborted (hard limit). No value means
+      that there is no hard time limit. */
+  std::optional<std::chrono::milliseconds> hardTime;
+}; // struct
+
+} // namespace
+
+#endif // SIMPLE_CHESS_SEARCHLIMITS_HPP
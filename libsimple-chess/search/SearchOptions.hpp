@@ -0,0 +1,56 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_SEARCHOPTIONS_HPP
+#define SIMPLE_CHESS_SEARCHOPTIONS_HPP
+
+namespace simplechess
+{
+
+/** \brief Switches for the selective parts of the search.
+ *
+ * All techniques are enabled by default. They can be turned off one by one,
+ * e.g. to compare the playing strength with and without a technique.
+ */
+struct SearchOptions
+{
+  /** Whether to prune positions where the player to move is still above
+      beta after passing the turn to the opponent (null move). In endgames
+      with little material the result is verified by a reduced search,
+      because zugzwang makes the null move assumption fail there. */
+  bool nullMovePruning = true;
+
+  /** Whether to search quiet moves late in the move ordering with reduced
+      depth first. Moves that turn out to be better than alpha are searched
+      again with full depth. */
+  bool lateMoveReductions = true;
+
+  /** Whether to skip quiet moves near the leaves, if the static evaluation
+      is so far below alpha that a quiet move will not get above it. */
+  bool futilityPruning = true;
+
+  /** Whether to drop into the quiescence search early near the leaves, if
+      the static evaluation is far below alpha. */
+  bool razoring = true;
+}; // struct
+
+} // namespace
+
+#endif // SIMPLE_CHESS_SEARCHOPTIONS_HPP
@@ -0,0 +1,213 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "TranspositionTable.hpp"
+#include <algorithm>
+
+namespace simplechess
+{
+
+/* Layout of the data word of an entry:
+   bits  0 -  5: origin field of the move
+   bits  6 - 11: destination field of the move
+   bits 12 - 14: promotion piece type
+   bits 16 - 17: bound
+   bits 18 - 23: age
+   bits 24 - 31: depth
+   bits 32 - 63: score
+   An empty move is stored as zero in bits 0 to 15. Every used entry has a
+   bound other than none or a move (or both), because store() ignores results
+   without either of them. So the data of a used entry is never zero, and zero
+   marks an empty entry. */
+
+/** \brief Packs entry data into a single 64 bit word. */
+std::uint64_t packEntry(const Move& move, const Bound bound, const std::uint8_t age, const unsigned int depth, const int score)
+{
+  std::uint64_t moveBits = 0;
+  if (!move.empty())
+  {
+    moveBits = static_cast<std::uint64_t>(move.from)
+        | (static_cast<std::uint64_t>(move.to) << 6)
+        | (static_cast<std::uint64_t>(move.promoteTo) << 12);
+  }
+  return moveBits
+      | (static_cast<std::uint64_t>(bound) << 16)
+      | (static_cast<std::uint64_t>(age & 63) << 18)
+      | (static_cast<std::uint64_t>(std::min(depth, 255u)) << 24)
+      | (static_cast<std::uint64_t>(static_cast<std::uint32_t>(score)) << 32);
+}
+
+/** \brief Gets the move from packed entry data. */
+Move unpackMove(const std::uint64_t data)
+{
+  if ((data & 0xFFFF) == 0)
+    return Move();
+  return Move(static_cast<Field>(data & 63), static_cast<Field>((data >> 6) & 63),
+              static_cast<PieceType>((data >> 12) & 7));
+}
+
+/** \brief Gets the age from packed entry data. */
+constexpr std::uint8_t unpackAge(const std::uint64_t data)
+{
+  return static_cast<std::uint8_t>((data >> 18) & 63);
+}
+
+/** \brief Gets the depth from packed entry data. */
+constexpr unsigned int unpackDepth(const std::uint64_t data)
+{
+  return static_cast<unsigned int>((data >> 24) & 255);
+}
+
+TranspositionTable::TranspositionTable(const std::size_t megabytes)
+: mBuckets(nullptr),
+  mBucketCount(0),
+  mMegabytes(0),
+  mAge(0)
+{
+  resize(megabytes);
+}
+
+void TranspositionTable::resize(const std::size_t megabytes)
+{
+  mMegabytes = std::clamp(megabytes, static_cast<std::size_t>(1), maximumSize);
+  // Use the largest power of two that fits into the requested size.
+  const std::size_t maxBuckets = (mMegabytes << 20) / sizeof(Bucket);
+  std::size_t count = 1;
+  while (count * 2 <= maxBuckets)
+  {
+    count *= 2;
+  }
+  mBuckets.reset(new Bucket[count]);
+  mBucketCount = count;
+  clear();
+}
+
+std::size_t TranspositionTable::size() const
+{
+  return mMegabytes;
+}
+
+void TranspositionTable::clear()
+{
+  for (std::size_t i = 0; i < mBucketCount; ++i)
+  {
+    for (Slot& slot : mBuckets[i].slots)
+    {
+      slot.check.store(0, std::memory_order_relaxed);
+      slot.data.store(0, std::memory_order_relaxed);
+    }
+  }
+  mAge = 0;
+}
+
+void TranspositionTable::newSearch()
+{
+  mAge = (mAge + 1) & 63;
+}
+
+bool TranspositionTable::probe(const std::uint64_t hash, Entry& entry) const
+{
+  const Bucket& bucket = mBuckets[hash & (mBucketCount - 1)];
+  for (const Slot& slot : bucket.slots)
+  {
+    const std::uint64_t data = slot.data.load(std::memory_order_relaxed);
+    const std::uint64_t check = slot.check.load(std::memory_order_relaxed);
+    if ((data != 0) && ((check ^ data) == hash))
+    {
+      entry.move = unpackMove(data);
+      entry.bound = static_cast<Bound>((data >> 16) & 3);
+      entry.depth = unpackDepth(data);
+      entry.score = static_cast<int>(static_cast<std::uint32_t>(data >> 32));
+      return true;
+    }
+  } // for
+  return false;
+}
+
+void TranspositionTable::store(const std::uint64_t hash, const unsigned int depth, const Bound bound, const int score, const Move& move)
+{
+  // Such an entry would look like an empty entry, and it has nothing to tell.
+  if ((bound == Bound::none) && move.empty())
+    return;
+
+  Bucket& bucket = mBuckets[hash & (mBucketCount - 1)];
+  Slot* victim = nullptr;
+  int victimValue = 0;
+  Move bestMove = move;
+  Bound newBound = bound;
+  unsigned int newDepth = depth;
+  int newScore = score;
+  for (Slot& slot : bucket.slots)
+  {
+    const std::uint64_t data = slot.data.load(std::memory_order_relaxed);
+    const std::uint64_t check = slot.check.load(std::memory_order_relaxed);
+    if ((data == 0) || ((check ^ data) == hash))
+    {
+      // Same position or empty entry: use it. Keep the old best move, if
+      // there is no new one, and keep the old score, if only the move is
+      // refreshed.
+      if (data != 0)
+      {
+        if (bestMove.empty())
+          bestMove = unpackMove(data);
+        if (bound == Bound::none)
+        {
+          newBound = static_cast<Bound>((data >> 16) & 3);
+          newDepth = unpackDepth(data);
+          newScore = static_cast<int>(static_cast<std::uint32_t>(data >> 32));
+        }
+      }
+      victim = &slot;
+      break;
+    }
+    // Prefer to replace shallow entries, where each search that passed since
+    // the entry was stored counts like eight plys less depth.
+    const int relativeAge = (mAge - unpackAge(data)) & 63;
+    const int value = static_cast<int>(unpackDepth(data)) - 8 * relativeAge;
+    if ((victim == nullptr) || (value < victimValue))
+    {
+      victim = &slot;
+      victimValue = value;
+    }
+  } // for
+
+  const std::uint64_t data = packEntry(bestMove, newBound, mAge, newDepth, newScore);
+  victim->data.store(data, std::memory_order_relaxed);
+  victim->check.store(hash ^ data, std::memory_order_relaxed);
+}
+
+unsigned int TranspositionTable::hashfull() const
+{
+  // Take a sample of the first 1000 entries (or less, if the table is small).
+  const std::size_t buckets = std::min(mBucketCount, static_cast<std::size_t>(250));
+  unsigned int used = 0;
+  for (std::size_t i = 0; i < buckets; ++i)
+  {
+    for (const Slot& slot : mBuckets[i].slots)
+    {
+      const std::uint64_t data = slot.data.load(std::memory_order_relaxed);
+      if ((data != 0) && (unpackAge(data) == mAge))
+        ++used;
+    }
+  }
+  return static_cast<unsigned int>(used * 1000 / (buckets * 4));
+}
+
+} // namespace
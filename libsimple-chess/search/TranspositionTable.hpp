@@ -0,0 +1,167 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef SIMPLE_CHESS_TRANSPOSITIONTABLE_HPP
+#define SIMPLE_CHESS_TRANSPOSITIONTABLE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "../data/Move.hpp"
+
+namespace simplechess
+{
+
+/** enumeration type for the kind of score stored in the transposition table */
+enum class Bound : std::uint8_t
+{
+  none,  /**< no score */
+  upper, /**< real score is less than or equal to the stored score (fail low) */
+  lower, /**< real score is greater than or equal to the stored score (fail high) */
+  exact  /**< stored score is the exact score */
+};
+
+
+/** \brief Hash table that stores search results of positions.
+ *
+ * \remarks The table consists of a power of two number of buckets. Each bucket
+ *          fills one cache line of 64 bytes and has four entries. Entries
+ *          consist of two 64 bit words: the data and the XOR of data and
+ *          position hash. Both words are read and written with relaxed atomic
+ *          operations, so several threads can share one table without locks.
+ *          If two threads write the same entry at once, the XOR check fails
+ *          for the torn entry and it is treated as a miss.
+ */
+class TranspositionTable
+{
+  public:
+    /** \brief Data of a single entry of the table. */
+    struct Entry
+    {
+      Move move; /**< best move of the position, may be empty */
+      int score; /**< score of the position */
+      unsigned int depth; /**< remaining search depth of the stored result */
+      Bound bound; /**< kind of score */
+    };
+
+
+    /** default size of the table in megabytes */
+    static constexpr std::size_t defaultSize = 16;
+
+
+    /** maximum size of the table in megabytes */
+    static constexpr std::size_t maximumSize = 65536;
+
+
+    /** \brief Constructor.
+     *
+     * \param megabytes  size of the table in megabytes
+     */
+    explicit TranspositionTable(const std::size_t megabytes = defaultSize);
+
+
+    /** \brief Changes the size of the table. This clears all entries.
+     *
+     * \param megabytes  new size of the table in megabytes, will be clamped
+     *                   to the range [1;maximumSize]
+     */
+    void resize(const std::size_t megabytes);
+
+
+    /** \brief Gets the size of the table.
+     *
+     * \return Returns the size of the table in megabytes, as requested by
+     *         the constructor or by resize().
+     */
+    std::size_t size() const;
+
+
+    /** \brief Removes all entries from the table. */
+    void clear();
+
+
+    /** \brief Tells the table that a new search starts.
+     *
+     * \remarks Entries from older searches are preferred for replacement.
+     */
+    void newSearch();
+
+
+    /** \brief Looks up a position in the table.
+     *
+     * \param hash   Zobrist hash of the position
+     * \param entry  receives the stored data, if the position is found
+     * \return Returns true, if the position was found.
+     *         Returns false otherwise.
+     */
+    bool probe(const std::uint64_t hash, Entry& entry) const;
+
+
+    /** \brief Stores the search result of a position.
+     *
+     * \param hash   Zobrist hash of the position
+     * \param depth  remaining search depth of the result
+     * \param bound  kind of score
+     * \param score  score of the position
+     * \param move   best move of the position; may be empty
+     * \remarks Within the bucket of the position the entry of the same
+     *          position is replaced, if there is one. Otherwise the entry with
+     *          the lowest depth, where older entries count as less deep, is
+     *          replaced.
+     * \remarks A result with the bound none only refreshes the move: depth,
+     *          bound and score of an existing entry of the same position are
+     *          kept then. A result without bound and without move is not
+     *          stored at all.
+     */
+    void store(const std::uint64_t hash, const unsigned int depth, const Bound bound, const int score, const Move& move);
+
+
+    /** \brief Estimates how much of the table is used by the current search.
+     *
+     * \return Returns the used portion of the table in permille.
+     */
+    unsigned int hashfull() const;
+  private:
+    /** single entry of the table */
+    struct Slot
+    {
+      std::atomic<std::uint64_t> check; /**< XOR of position hash and data */
+      std::atomic<std::uint64_t> data; /**< packed entry data */
+    };
+
+    /** group of entries that fills one cache line */
+    struct alignas(64) Bucket
+    {
+      std::array<Slot, 4> slots; /**< entries of the bucket */
+    };
+
+    static_assert(sizeof(Bucket) == 64, "Bucket has to fill exactly one cache line!");
+
+    std::unique_ptr<Bucket[]> mBuckets; /**< buckets of the table */
+    std::size_t mBucketCount; /**< number of buckets, always a power of two */
+    std::size_t mMegabytes; /**< requested size of the table in megabytes */
+    std::uint8_t mAge; /**< age of the current search, six bits */
+}; // class
+
+} // namespace
+
+#endif // SIMPLE_CHESS_TRANSPOSITIONTABLE_HPP
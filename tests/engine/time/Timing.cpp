@@ -0,0 +1,131 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the test suite for simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+
+
+#include "../../locate_catch.hpp"
+#include "../../../apps/engine/time/Timing.hpp"
+
+TEST_CASE("Timing")
+{
+  using namespace simplechess;
+
+  SECTION("move counter")
+  {
+    Timing timing;
+    REQUIRE( timing.movesDone() == 0 );
+    timing.countMove();
+    timing.countMove();
+    REQUIRE( timing.movesDone() == 2 );
+    timing.resetMoves();
+    REQUIRE( timing.movesDone() == 0 );
+  }
+
+  SECTION("budget in exact mode")
+  {
+    Timing timing;
+    timing.setMode(TimeControlMode::exact);
+    timing.setExact(std::chrono::seconds(10));
+    const centiseconds budget = timing.moveBudget();
+    REQUIRE( budget <= std::chrono::seconds(10) );
+    REQUIRE( budget >= std::chrono::seconds(9) );
+  }
+
+  SECTION("budget in conventional mode")
+  {
+    Timing timing;
+    timing.setMode(TimeControlMode::conventional);
+    timing.setConventional(40, std::chrono::seconds(400));
+    // About ten seconds per move.
+    const centiseconds first = timing.moveBudget();
+    REQUIRE( first <= std::chrono::seconds(10) );
+    REQUIRE( first >= std::chrono::seconds(9) );
+
+    // Last move before the time control may use (almost) all of the time.
+    for (int i = 0; i < 39; ++i)
+    {
+      timing.countMove();
+    }
+    timing.self().setRemaining(std::chrono::seconds(20));
+    const centiseconds last = timing.moveBudget();
+    REQUIRE( last < std::chrono::seconds(20) );
+    REQUIRE( last >= std::chrono::seconds(19) );
+
+    // After the time control the time is distributed among 40 moves again.
+    timing.countMove();
+    timing.self().setRemaining(std::chrono::seconds(400));
+    REQUIRE( timing.moveBudget() == first );
+  }
+
+  SECTION("budget in incremental mode")
+  {
+    Timing timing;
+    timing.setMode(TimeControlMode::incremental);
+    timing.setIncremental(std::chrono::seconds(300), std::chrono::seconds(4));
+    // Part of the base time plus most of the increment.
+    const centiseconds budget = timing.moveBudget();
+    REQUIRE( budget > std::chrono::seconds(3) );
+    REQUIRE( budget < std::chrono::seconds(15) );
+  }
+
+  SECTION("budget in sudden death with little time left")
+  {
+    Timing timing;
+    timing.setMode(TimeControlMode::incremental);
+    // level 0 1 0, i.e. no increment at all
+    timing.setIncremental(std::chrono::seconds(60), std::chrono::seconds(0));
+    centiseconds remaining(200);
+    for (int i = 0; i < 20; ++i)
+    {
+      timing.self().setRemaining(remaining);
+      const centiseconds budget = timing.moveBudget();
+      REQUIRE( budget > centiseconds(0) );
+      REQUIRE( budget <= remaining / 20 );
+      remaining -= budget;
+    }
+    // Enough time is left for the rest of the game.
+    REQUIRE( remaining > centiseconds(100) );
+  }
+
+  SECTION("increment does not use up the remaining time")
+  {
+    Timing timing;
+    timing.setMode(TimeControlMode::incremental);
+    timing.setIncremental(std::chrono::seconds(60), std::chrono::seconds(2));
+    timing.self().setRemaining(centiseconds(100));
+    const centiseconds budget = timing.moveBudget();
+    REQUIRE( budget > centiseconds(0) );
+    REQUIRE( budget <= centiseconds(50) );
+  }
+
+  SECTION("budget never exceeds remaining time")
+  {
+    Timing timing;
+    timing.setMode(TimeControlMode::incremental);
+    timing.setIncremental(std::chrono::seconds(300), std::chrono::seconds(30));
+    timing.self().setRemaining(centiseconds(200));
+    const centiseconds budget = timing.moveBudget();
+    REQUIRE( budget < centiseconds(200) );
+    REQUIRE( budget > centiseconds(0) );
+
+    timing.self().setRemaining(centiseconds(0));
+    REQUIRE( timing.moveBudget() == centiseconds(1) );
+  }
+}
@@ -0,0 +1,104 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../locate_catch.hpp"
+#include "../../../apps/engine/uci/Go.hpp"
+
+TEST_CASE("uci::Go")
+{
+  using namespace simplechess;
+  using namespace std::chrono_literals;
+
+  SECTION("no parameters: no limits except maximum depth")
+  {
+    const uci::Go go;
+    const SearchLimits limits = go.limits(Colour::white, 100);
+    REQUIRE( limits.depth == 100 );
+    REQUIRE( limits.nodes == 0 );
+    REQUIRE_FALSE( limits.softTime.has_value() );
+    REQUIRE_FALSE( limits.hardTime.has_value() );
+  }
+
+  SECTION("depth, nodes and mate")
+  {
+    uci::GoParameters params;
+    params.depth = 12;
+    params.nodes = 50000;
+    const SearchLimits limits = uci::Go(params).limits(Colour::white, 100);
+    REQUIRE( limits.depth == 12 );
+    REQUIRE( limits.nodes == 50000 );
+
+    params.mate = 3;
+    REQUIRE( uci::Go(params).limits(Colour::white, 100).depth == 5 );
+  }
+
+  SECTION("movetime is a soft and a hard limit")
+  {
+    uci::GoParameters params;
+    params.moveTime = 1000ms;
+    const SearchLimits limits = uci::Go(params).limits(Colour::black, 100);
+    REQUIRE( limits.softTime.has_value() );
+    REQUIRE( limits.hardTime.has_value() );
+    REQUIRE( limits.softTime.value() == limits.hardTime.value() );
+    REQUIRE( limits.hardTime.value() < 1000ms );
+    REQUIRE( limits.hardTime.value() >= 900ms );
+  }
+
+  SECTION("clock of the side to move is used")
+  {
+    uci::GoParameters params;
+    params.whiteTime = 60000ms;
+    params.blackTime = 1000ms;
+    const SearchLimits white = uci::Go(params).limits(Colour::white, 100);
+    const SearchLimits black = uci::Go(params).limits(Colour::black, 100);
+    REQUIRE( white.hardTime.value() > black.hardTime.value() );
+    REQUIRE( white.softTime.value() < white.hardTime.value() );
+    REQUIRE( black.softTime.value() < black.hardTime.value() );
+  }
+
+  SECTION("hard limit never exceeds the remaining time")
+  {
+    uci::GoParameters params;
+    params.whiteTime = 100ms;
+    params.whiteIncrement = 1000ms;
+    params.movesToGo = 1;
+    const SearchLimits limits = uci::Go(params).limits(Colour::white, 100);
+    REQUIRE( limits.hardTime.value() < 100ms );
+    REQUIRE( limits.softTime.value() <= limits.hardTime.value() );
+  }
+
+  SECTION("negative remaining time still allows a short search")
+  {
+    uci::GoParameters params;
+    params.blackTime = -50ms;
+    const SearchLimits limits = uci::Go(params).limits(Colour::black, 100);
+    REQUIRE( limits.hardTime.value() == 1ms );
+  }
+
+  SECTION("infinite removes time limits")
+  {
+    uci::GoParameters params;
+    params.whiteTime = 1000ms;
+    params.infinite = true;
+    const SearchLimits limits = uci::Go(params).limits(Colour::white, 100);
+    REQUIRE_FALSE( limits.softTime.has_value() );
+    REQUIRE_FALSE( limits.hardTime.has_value() );
+  }
+}
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for simple-chess.
-    Copyright (C) 2022  Dirk Stolle
+    Copyright (C) 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,14 +22,19 @@
 #include "../../locate_catch.hpp"
 #include "../../../apps/engine/Engine.hpp"
 #include "../../../apps/engine/xboard/CommandParser.hpp"
+#include "../../../apps/engine/xboard/Cores.hpp"
 #include "../../../apps/engine/xboard/Draw.hpp"
 #include "../../../apps/engine/xboard/ExactTime.hpp"
 #include "../../../apps/engine/xboard/Error.hpp"
 #include "../../../apps/engine/xboard/Force.hpp"
 #include "../../../apps/engine/xboard/Go.hpp"
 #include "../../../apps/engine/xboard/Level.hpp"
+#include "../../../apps/engine/xboard/Memory.hpp"
+#include "../../../apps/engine/xboard/MoveNow.hpp"
 #include "../../../apps/engine/xboard/New.hpp"
 #include "../../../apps/engine/xboard/Ping.hpp"
+#include "../../../apps/engine/xboard/Ponder.hpp"
+#include "../../../apps/engine/xboard/Post.hpp"
 #include "../../../apps/engine/xboard/ProtocolVersion.hpp"
 #include "../../../apps/engine/xboard/Quit.hpp"
 #include "../../../apps/engine/xboard/ResultCmd.hpp"
@@ -82,6 +87,14 @@ TEST_CASE("CommandParser")
     REQUIRE( noErrorInQueue() );
   }
 
+  SECTION("? (move now)")
+  {
+    CommandParser::parse("?");
+    REQUIRE( noErrorInQueue() );
+    REQUIRE( lastQueueElementIs<MoveNow>() );
+    REQUIRE( simplechess::Engine::get().queue().back()->allowedDuringSearch() );
+  }
+
   SECTION("accepted")
   {
     CommandParser::parse("accepted SomeFeature");
@@ -97,6 +110,34 @@ TEST_CASE("CommandParser")
     // No-op, i. e. no command is generated.
   }
 
+  SECTION("cores")
+  {
+    SECTION("correct usage with argument")
+    {
+      CommandParser::parse("cores 4");
+      REQUIRE( noErrorInQueue() );
+      REQUIRE( lastQueueElementIs<Cores>() );
+      const auto* cmd = dynamic_cast<Cores*>(simplechess::Engine::get().queue().back().get());
+      REQUIRE( cmd->cores() == 4 );
+    }
+
+    SECTION("wrong usage with non-integer argument")
+    {
+      CommandParser::parse("cores many");
+      REQUIRE_FALSE( noErrorInQueue() );
+      REQUIRE( lastQueueElementIs<Error>() );
+      clearCommandQueue();
+    }
+
+    SECTION("integer argument out of range")
+    {
+      CommandParser::parse("cores 0");
+      REQUIRE_FALSE( noErrorInQueue() );
+      REQUIRE( lastQueueElementIs<Error>() );
+      clearCommandQueue();
+    }
+  }
+
   SECTION("draw")
   {
     CommandParser::parse("draw");
@@ -108,7 +149,9 @@ TEST_CASE("CommandParser")
   {
     CommandParser::parse("easy");
     REQUIRE( noErrorInQueue() );
-    // No-op, i. e. no command is generated.
+    REQUIRE( lastQueueElementIs<Ponder>() );
+    const auto* cmd = dynamic_cast<Ponder*>(simplechess::Engine::get().queue().back().get());
+    REQUIRE_FALSE( cmd->enabled() );
   }
 
   SECTION("force")
@@ -123,13 +166,16 @@ TEST_CASE("CommandParser")
     CommandParser::parse("go");
     REQUIRE( noErrorInQueue() );
     REQUIRE( lastQueueElementIs<Go>() );
+    REQUIRE_FALSE( simplechess::Engine::get().queue().back()->allowedDuringSearch() );
   }
 
   SECTION("hard")
   {
     CommandParser::parse("hard");
     REQUIRE( noErrorInQueue() );
-    // No-op, i. e. no command is generated.
+    REQUIRE( lastQueueElementIs<Ponder>() );
+    const auto* cmd = dynamic_cast<Ponder*>(simplechess::Engine::get().queue().back().get());
+    REQUIRE( cmd->enabled() );
   }
 
   SECTION("level")
@@ -183,6 +229,34 @@ TEST_CASE("CommandParser")
     }
   }
 
+  SECTION("memory")
+  {
+    SECTION("correct usage with argument")
+    {
+      CommandParser::parse("memory 64");
+      REQUIRE( noErrorInQueue() );
+      REQUIRE( lastQueueElementIs<Memory>() );
+      const auto* mem = dynamic_cast<Memory*>(simplechess::Engine::get().queue().back().get());
+      REQUIRE( mem->megabytes() == 64 );
+    }
+
+    SECTION("wrong usage with non-integer argument")
+    {
+      CommandParser::parse("memory lots");
+      REQUIRE_FALSE( noErrorInQueue() );
+      REQUIRE( lastQueueElementIs<Error>() );
+      clearCommandQueue();
+    }
+
+    SECTION("integer argument out of range")
+    {
+      CommandParser::parse("memory 0");
+      REQUIRE_FALSE( noErrorInQueue() );
+      REQUIRE( lastQueueElementIs<Error>() );
+      clearCommandQueue();
+    }
+  }
+
   SECTION("new")
   {
     CommandParser::parse("new");
@@ -194,7 +268,9 @@ TEST_CASE("CommandParser")
   {
     CommandParser::parse("nopost");
     REQUIRE( noErrorInQueue() );
-    // No-op, i. e. no command is generated.
+    REQUIRE( lastQueueElementIs<Post>() );
+    const auto* cmd = dynamic_cast<Post*>(simplechess::Engine::get().queue().back().get());
+    REQUIRE_FALSE( cmd->enabled() );
   }
 
   SECTION("otim")
@@ -237,7 +313,9 @@ TEST_CASE("CommandParser")
   {
     CommandParser::parse("post");
     REQUIRE( noErrorInQueue() );
-    // No-op, i. e. no command is generated.
+    REQUIRE( lastQueueElementIs<Post>() );
+    const auto* cmd = dynamic_cast<Post*>(simplechess::Engine::get().queue().back().get());
+    REQUIRE( cmd->enabled() );
   }
 
   SECTION("protover")
@@ -252,6 +330,7 @@ TEST_CASE("CommandParser")
     CommandParser::parse("quit");
     REQUIRE( noErrorInQueue() );
     REQUIRE( lastQueueElementIs<Quit>() );
+    REQUIRE( simplechess::Engine::get().queue().back()->allowedDuringSearch() );
   }
 
   SECTION("random")
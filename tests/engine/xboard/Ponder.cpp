@@ -0,0 +1,104 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <chrono>
+#include <thread>
+#include "../../locate_catch.hpp"
+#include "../../../apps/engine/Engine.hpp"
+#include "../../../apps/engine/xboard/CommandParser.hpp"
+
+namespace
+{
+
+/** \brief Waits until a condition is true, but at most ten seconds.
+ *
+ * \param condition  the condition
+ * \return Returns true, if the condition became true in time.
+ */
+template<typename Condition>
+bool waitFor(Condition condition)
+{
+  using namespace std::chrono_literals;
+  const auto deadline = std::chrono::steady_clock::now() + 10s;
+  while (!condition())
+  {
+    if (std::chrono::steady_clock::now() > deadline)
+      return false;
+    std::this_thread::sleep_for(1ms);
+  } // while
+  return true;
+}
+
+std::string coordinates(const simplechess::Move& move)
+{
+  using namespace simplechess;
+  std::string result;
+  result.push_back(column(move.from));
+  result.append(std::to_string(row(move.from)));
+  result.push_back(column(move.to));
+  result.append(std::to_string(row(move.to)));
+  return result;
+}
+
+} // namespace
+
+TEST_CASE("xboard: commands right after the engine's move while pondering")
+{
+  using namespace simplechess;
+  using namespace simplechess::xboard;
+  Engine& engine = Engine::get();
+  engine.mutableQueue().clear();
+
+  for (const char* cmd : { "xboard", "new", "hard", "sd 4", "level 0 1 0",
+                                  "time 6000", "otim 6000", "usermove e2e4" })
+  {
+    CommandParser::parse(cmd);
+  }
+  REQUIRE( engine.processQueue() == 8 );
+
+  // The engine answers and then ponders on the expected reply.
+  REQUIRE( waitFor([&engine]() { return engine.pondering() || !engine.searching(); }) );
+  REQUIRE( engine.pondering() );
+  const Move expected = engine.ponderMove();
+
+  // xboard sends the clocks and the move of the opponent immediately. None of
+  // them waits for the ponder search.
+  CommandParser::parse("time 5900");
+  CommandParser::parse("otim 5800");
+  CommandParser::parse("usermove " + coordinates(expected));
+  REQUIRE( engine.processQueue() == 3 );
+  REQUIRE_FALSE( engine.pondering() );
+
+  // After the ponder hit the search sends its move and ponders again.
+  REQUIRE( waitFor([&engine]() { return engine.pondering() || !engine.searching(); }) );
+  engine.cancelSearch();
+  REQUIRE( engine.board().toMove() == Colour::white );
+  REQUIRE( engine.timing().self().remaining() <= centiseconds(5900) );
+  REQUIRE( engine.timing().self().remaining() > centiseconds(0) );
+  // The clock of the opponent was running, so otim does not change it.
+  REQUIRE( engine.timing().opponent().remaining() <= centiseconds(6000) );
+
+  // Leave the engine in its usual state for other tests.
+  for (const char* cmd : { "easy", "new" })
+  {
+    CommandParser::parse(cmd);
+  }
+  REQUIRE( engine.processQueue() == 2 );
+}
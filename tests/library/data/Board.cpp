@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for simple-chess.
-    Copyright (C) 2017, 2018, 2023  Dirk Stolle
+    Copyright (C) 2017, 2018, 2023, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,6 +22,8 @@
 #include "../../locate_catch.hpp"
 #include "../../../libsimple-chess/data/Board.hpp"
 #include "../../../libsimple-chess/data/ForsythEdwardsNotation.hpp"
+#include "../../../libsimple-chess/data/Zobrist.hpp"
+#include "../../../libsimple-chess/rules/Moves.hpp"
 
 TEST_CASE("Board constructor")
 {
@@ -600,6 +602,429 @@ TEST_CASE("Board::move()")
   }
 }
 
+/** Checks whether two boards are equal in all aspects. */
+void requireSameBoard(const simplechess::Board& a, const simplechess::Board& b)
+{
+  using namespace simplechess;
+  for (int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
+  {
+    REQUIRE( a.element(static_cast<Field>(i)) == b.element(static_cast<Field>(i)) );
+  }
+  REQUIRE( a.toMove() == b.toMove() );
+  REQUIRE( a.enPassant() == b.enPassant() );
+  REQUIRE( a.halfmovesFifty() == b.halfmovesFifty() );
+  REQUIRE( a.castling().toFEN() == b.castling().toFEN() );
+  REQUIRE( a.castling().white_castled == b.castling().white_castled );
+  REQUIRE( a.castling().black_castled == b.castling().black_castled );
+  REQUIRE( a.isInCheck(Colour::white) == b.isInCheck(Colour::white) );
+  REQUIRE( a.isInCheck(Colour::black) == b.isInCheck(Colour::black) );
+  REQUIRE( a.hash() == b.hash() );
+}
+
+TEST_CASE("Board::makeMove() + Board::unmakeMove()")
+{
+  using namespace simplechess;
+  Board board;
+  UndoRecord undo;
+
+  SECTION("simple pawn move")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 7") );
+    const Board original(board);
+    Board moved(board);
+    REQUIRE( moved.move(Field::e2, Field::e4, PieceType::queen) );
+
+    board.makeMove(Field::e2, Field::e4, PieceType::queen, undo);
+    requireSameBoard(board, moved);
+    REQUIRE( undo.moved == Piece(Colour::white, PieceType::pawn) );
+    REQUIRE( undo.captured == Piece() );
+    REQUIRE( undo.halfmoves50 == 7 );
+
+    board.unmakeMove(Field::e2, Field::e4, undo);
+    requireSameBoard(board, original);
+  }
+
+  SECTION("capture with check")
+  {
+    REQUIRE( board.fromFEN("4k3/8/8/8/8/8/4r3/R3K3 w - - 3") );
+    const Board original(board);
+    REQUIRE( board.isInCheck(Colour::white) );
+    Board moved(board);
+    REQUIRE( moved.move(Field::e1, Field::e2, PieceType::queen) );
+
+    board.makeMove(Field::e1, Field::e2, PieceType::queen, undo);
+    requireSameBoard(board, moved);
+    REQUIRE( undo.captured == Piece(Colour::black, PieceType::rook) );
+    REQUIRE( undo.capturedAt == Field::e2 );
+    REQUIRE( undo.whiteInCheck );
+
+    board.unmakeMove(Field::e1, Field::e2, undo);
+    requireSameBoard(board, original);
+  }
+
+  SECTION("en passant capture")
+  {
+    REQUIRE( board.fromFEN("k6K/8/8/8/4Pp2/8/8/8 b - e3") );
+    const Board original(board);
+    Board moved(board);
+    REQUIRE( moved.move(Field::f4, Field::e3, PieceType::queen) );
+
+    board.makeMove(Field::f4, Field::e3, PieceType::queen, undo);
+    requireSameBoard(board, moved);
+    REQUIRE( undo.captured == Piece(Colour::white, PieceType::pawn) );
+    REQUIRE( undo.capturedAt == Field::e4 );
+
+    board.unmakeMove(Field::f4, Field::e3, undo);
+    requireSameBoard(board, original);
+  }
+
+  SECTION("pawn promotion")
+  {
+    REQUIRE( board.fromFEN("1r5k/P7/8/8/8/8/8/K7 w") );
+    const Board original(board);
+
+    for (const auto promo : { PieceType::queen, PieceType::rook, PieceType::bishop, PieceType::knight })
+    {
+      Board moved(board);
+      REQUIRE( moved.move(Field::a7, Field::b8, promo) );
+
+      board.makeMove(Field::a7, Field::b8, promo, undo);
+      requireSameBoard(board, moved);
+      REQUIRE( board.element(Field::b8) == Piece(Colour::white, promo) );
+
+      board.unmakeMove(Field::a7, Field::b8, undo);
+      requireSameBoard(board, original);
+    }
+  }
+
+  SECTION("castling")
+  {
+    REQUIRE( board.fromFEN("r3k2r/pppppppp/8/8/8/8/PPPPPPPP/R3K2R w KQkq - 0") );
+    const Board original(board);
+
+    SECTION("white")
+    {
+      for (const auto dest : { Field::c1, Field::g1 })
+      {
+        Board moved(board);
+        REQUIRE( moved.move(Field::e1, dest, PieceType::queen) );
+
+        board.makeMove(Field::e1, dest, PieceType::queen, undo);
+        requireSameBoard(board, moved);
+
+        board.unmakeMove(Field::e1, dest, undo);
+        requireSameBoard(board, original);
+      }
+    }
+
+    SECTION("black")
+    {
+      board.setToMove(Colour::black);
+      const Board blackToMove(board);
+      for (const auto dest : { Field::c8, Field::g8 })
+      {
+        Board moved(board);
+        REQUIRE( moved.move(Field::e8, dest, PieceType::queen) );
+
+        board.makeMove(Field::e8, dest, PieceType::queen, undo);
+        requireSameBoard(board, moved);
+
+        board.unmakeMove(Field::e8, dest, undo);
+        requireSameBoard(board, blackToMove);
+      }
+    }
+  }
+
+  SECTION("sequence of moves is undone in reverse order")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0") );
+    const Board original(board);
+    UndoRecord first, second, third;
+    board.makeMove(Field::e2, Field::e4, PieceType::queen, first);
+    board.makeMove(Field::d7, Field::d5, PieceType::queen, second);
+    board.makeMove(Field::e4, Field::d5, PieceType::queen, third);
+    REQUIRE( ForsythEdwardsNotation::fromBoard(board) ==
+      "rnbqkbnr/ppp1pppp/8/3P4/8/8/PPPP1PPP/RNBQKBNR b KQkq - 0"
+    );
+    board.unmakeMove(Field::e4, Field::d5, third);
+    board.unmakeMove(Field::d7, Field::d5, second);
+    board.unmakeMove(Field::e2, Field::e4, first);
+    requireSameBoard(board, original);
+  }
+}
+
+/** Checks whether the bitboards of a board match its fields. */
+void requireBitboardsInSync(const simplechess::Board& board)
+{
+  using namespace simplechess;
+  for (int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
+  {
+    const Field f = static_cast<Field>(i);
+    const Piece& piece = board.element(f);
+    for (const auto colour : { Colour::none, Colour::white, Colour::black })
+    {
+      REQUIRE( ((board.pieces(colour) & fieldBit(f)) != 0) == (piece.colour() == colour) );
+    }
+    for (const auto type : { PieceType::king, PieceType::queen, PieceType::bishop, PieceType::knight, PieceType::rook, PieceType::pawn, PieceType::none })
+    {
+      REQUIRE( ((board.pieces(type) & fieldBit(f)) != 0) == (piece.piece() == type) );
+    }
+    REQUIRE( ((board.pieces(piece.colour(), piece.piece()) & fieldBit(f)) != 0) );
+    REQUIRE( ((board.occupied() & fieldBit(f)) != 0) == (piece.piece() != PieceType::none) );
+  }
+}
+
+TEST_CASE("Board::makeNullMove() + Board::unmakeNullMove()")
+{
+  using namespace simplechess;
+  Board board;
+  REQUIRE( board.fromFEN("rnbqkbnr/ppp1pppp/8/8/3pP3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 3") );
+  const Board original(board);
+
+  UndoRecord undo;
+  board.makeNullMove(undo);
+  REQUIRE( board.toMove() == Colour::white );
+  REQUIRE( board.enPassant() == Field::none );
+  REQUIRE( board.halfmovesFifty() == 1 );
+  REQUIRE( board.hash() == Zobrist::compute(board) );
+  REQUIRE( board.hash() != original.hash() );
+  // Pieces and castling rights do not change.
+  REQUIRE( board.occupied() == original.occupied() );
+  REQUIRE( board.castling().white_kingside == original.castling().white_kingside );
+  REQUIRE( board.castling().black_queenside == original.castling().black_queenside );
+
+  board.unmakeNullMove(undo);
+  REQUIRE( board.toMove() == Colour::black );
+  REQUIRE( board.enPassant() == Field::e3 );
+  REQUIRE( board.halfmovesFifty() == 0 );
+  REQUIRE( board.hash() == original.hash() );
+}
+
+TEST_CASE("Board::pieces()")
+{
+  using namespace simplechess;
+  Board board;
+
+  SECTION("empty board")
+  {
+    REQUIRE( board.occupied() == 0 );
+    REQUIRE( board.pieces(Colour::none) == ~static_cast<Bitboard>(0) );
+    REQUIRE( board.pieces(PieceType::none) == ~static_cast<Bitboard>(0) );
+    requireBitboardsInSync(board);
+  }
+
+  SECTION("start position")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+    requireBitboardsInSync(board);
+    REQUIRE( popCount(board.occupied()) == 32 );
+    REQUIRE( popCount(board.pieces(Colour::white)) == 16 );
+    REQUIRE( popCount(board.pieces(Colour::black, PieceType::pawn)) == 8 );
+    REQUIRE( board.pieces(Colour::white, PieceType::king) == fieldBit(Field::e1) );
+    REQUIRE( board.pieces(Colour::black, PieceType::queen) == fieldBit(Field::d8) );
+  }
+
+  SECTION("setElement() keeps bitboards in sync")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+    REQUIRE( board.setElement(Field::e2, Piece()) );
+    REQUIRE( board.setElement(Field::e4, Piece(Colour::white, PieceType::pawn)) );
+    REQUIRE( board.setElement(Field::d8, Piece(Colour::black, PieceType::knight)) );
+    requireBitboardsInSync(board);
+  }
+
+  SECTION("moves keep bitboards in sync")
+  {
+    REQUIRE( board.fromFEN("r3k2r/p1pp1pb1/bn2pnp1/2qPN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1") );
+    requireBitboardsInSync(board);
+    UndoRecord castling, capture, enPassantStart, enPassant;
+    // castling
+    board.makeMove(Field::e1, Field::g1, PieceType::queen, castling);
+    requireBitboardsInSync(board);
+    // capture
+    board.makeMove(Field::c5, Field::c3, PieceType::queen, capture);
+    requireBitboardsInSync(board);
+    // double step, then en passant
+    board.makeMove(Field::a2, Field::a4, PieceType::queen, enPassantStart);
+    requireBitboardsInSync(board);
+    board.makeMove(Field::b4, Field::a3, PieceType::queen, enPassant);
+    requireBitboardsInSync(board);
+    REQUIRE( board.element(Field::a4) == Piece() );
+
+    board.unmakeMove(Field::b4, Field::a3, enPassant);
+    requireBitboardsInSync(board);
+    board.unmakeMove(Field::a2, Field::a4, enPassantStart);
+    requireBitboardsInSync(board);
+    board.unmakeMove(Field::c5, Field::c3, capture);
+    requireBitboardsInSync(board);
+    board.unmakeMove(Field::e1, Field::g1, castling);
+    requireBitboardsInSync(board);
+
+    // promotion via move()
+    REQUIRE( board.fromFEN("1r5k/P7/8/8/8/8/8/K7 w - - 0 1") );
+    REQUIRE( board.move(Field::a7, Field::b8, PieceType::knight) );
+    requireBitboardsInSync(board);
+    REQUIRE( board.pieces(Colour::white, PieceType::knight) == fieldBit(Field::b8) );
+    REQUIRE( board.pieces(PieceType::pawn) == 0 );
+  }
+}
+
+TEST_CASE("Board::hash()")
+{
+  using namespace simplechess;
+  Board board;
+
+  SECTION("hash of empty board matches full computation")
+  {
+    REQUIRE( board.hash() == Zobrist::compute(board) );
+  }
+
+  SECTION("same position via different move orders has same hash")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+    Board other(board);
+    REQUIRE( board.move(Field::g1, Field::f3, PieceType::queen) );
+    REQUIRE( board.move(Field::g8, Field::f6, PieceType::queen) );
+    REQUIRE( board.move(Field::b1, Field::c3, PieceType::queen) );
+    REQUIRE( board.move(Field::b8, Field::c6, PieceType::queen) );
+
+    REQUIRE( other.move(Field::b1, Field::c3, PieceType::queen) );
+    REQUIRE( other.move(Field::b8, Field::c6, PieceType::queen) );
+    REQUIRE( other.move(Field::g1, Field::f3, PieceType::queen) );
+    REQUIRE( other.move(Field::g8, Field::f6, PieceType::queen) );
+
+    REQUIRE( board.hash() == other.hash() );
+    REQUIRE( board.hash() == Zobrist::compute(board) );
+
+    Board fromFEN;
+    REQUIRE( fromFEN.fromFEN("r1bqkb1r/pppppppp/2n2n2/8/8/2N2N2/PPPPPPPP/R1BQKB1R w KQkq - 4 3") );
+    REQUIRE( board.hash() == fromFEN.hash() );
+  }
+
+  SECTION("side to move, castling rights and en passant change the hash")
+  {
+    REQUIRE( board.fromFEN("r3k2r/pppppppp/8/8/4P3/8/PPPP1PPP/R3K2R b KQkq e3 0 1") );
+    const auto original = board.hash();
+
+    REQUIRE( board.fromFEN("r3k2r/pppppppp/8/8/4P3/8/PPPP1PPP/R3K2R w KQkq e3 0 1") );
+    REQUIRE( board.hash() != original );
+    REQUIRE( board.fromFEN("r3k2r/pppppppp/8/8/4P3/8/PPPP1PPP/R3K2R b Kkq e3 0 1") );
+    REQUIRE( board.hash() != original );
+    REQUIRE( board.fromFEN("r3k2r/pppppppp/8/8/4P3/8/PPPP1PPP/R3K2R b KQkq - 0 1") );
+    REQUIRE( board.hash() != original );
+    // Number of half moves is not part of the hash.
+    REQUIRE( board.fromFEN("r3k2r/pppppppp/8/8/4P3/8/PPPP1PPP/R3K2R b KQkq e3 5 1") );
+    REQUIRE( board.hash() == original );
+  }
+
+  SECTION("setters update the hash")
+  {
+    REQUIRE( board.fromFEN("r3k2r/pppppppp/8/8/8/8/PPPPPPPP/R3K2R w KQkq - 0 1") );
+    REQUIRE( board.setToMove(Colour::black) );
+    REQUIRE( board.hash() == Zobrist::compute(board) );
+    REQUIRE( board.setEnPassant(Field::d3) );
+    REQUIRE( board.hash() == Zobrist::compute(board) );
+    Castling castling = board.castling();
+    castling.white_queenside = false;
+    board.setCastling(castling);
+    REQUIRE( board.hash() == Zobrist::compute(board) );
+    REQUIRE( board.setElement(Field::e4, Piece(Colour::white, PieceType::knight)) );
+    REQUIRE( board.hash() == Zobrist::compute(board) );
+  }
+
+  SECTION("incremental hash matches full computation during moves")
+  {
+    REQUIRE( board.fromFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1") );
+    MoveList moves;
+    Moves::generate(board, moves);
+    for (const Move& move : moves)
+    {
+      const auto before = board.hash();
+      UndoRecord undo;
+      board.makeMove(move.from, move.to, move.promoteTo, undo);
+      REQUIRE( board.hash() == Zobrist::compute(board) );
+      REQUIRE( board.hash() != before );
+
+      MoveList replies;
+      Moves::generate(board, replies);
+      for (const Move& reply : replies)
+      {
+        UndoRecord replyUndo;
+        board.makeMove(reply.from, reply.to, reply.promoteTo, replyUndo);
+        REQUIRE( board.hash() == Zobrist::compute(board) );
+        board.unmakeMove(reply.from, reply.to, replyUndo);
+      }
+
+      board.unmakeMove(move.from, move.to, undo);
+      REQUIRE( board.hash() == before );
+    }
+  }
+}
+
+TEST_CASE("Board::material()")
+{
+  using namespace simplechess;
+  Board board;
+
+  SECTION("empty board and start position are even")
+  {
+    REQUIRE( board.material() == 0 );
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+    REQUIRE( board.material() == 0 );
+    REQUIRE( board.pieceCount(Colour::white, PieceType::pawn) == 8 );
+    REQUIRE( board.pieceCount(Colour::black, PieceType::knight) == 2 );
+    REQUIRE( board.pieceCount(Colour::black, PieceType::queen) == 1 );
+  }
+
+  SECTION("setElement() updates the material balance")
+  {
+    REQUIRE( board.setElement(Field::e4, Piece(Colour::white, PieceType::queen)) );
+    REQUIRE( board.material() == 900 );
+    REQUIRE( board.setElement(Field::e4, Piece(Colour::black, PieceType::rook)) );
+    REQUIRE( board.material() == -500 );
+    REQUIRE( board.setElement(Field::e4, Piece(Colour::none, PieceType::none)) );
+    REQUIRE( board.material() == 0 );
+  }
+
+  SECTION("captures, promotions and their undo update the material balance")
+  {
+    REQUIRE( board.fromFEN("1n2k3/P7/8/3p4/4P3/8/8/4K3 w - - 0 1") );
+    REQUIRE( board.material() == -200 );
+
+    UndoRecord capture;
+    board.makeMove(Field::e4, Field::d5, PieceType::queen, capture);
+    REQUIRE( board.material() == -100 );
+    UndoRecord promotion;
+    board.makeMove(Field::a7, Field::b8, PieceType::knight, promotion);
+    REQUIRE( board.material() == 400 );
+
+    board.unmakeMove(Field::a7, Field::b8, promotion);
+    REQUIRE( board.material() == -100 );
+    board.unmakeMove(Field::e4, Field::d5, capture);
+    REQUIRE( board.material() == -200 );
+  }
+}
+
+TEST_CASE("Board: capture of a rook removes the castling right")
+{
+  using namespace simplechess;
+  Board board;
+
+  REQUIRE( board.fromFEN("r3k2r/8/8/8/8/6n1/8/R3K2R b KQkq - 0 1") );
+  REQUIRE( board.move(Field::g3, Field::h1, PieceType::queen) );
+  REQUIRE_FALSE( board.castling().white_kingside );
+  REQUIRE( board.castling().white_queenside );
+  // Without the rook the king cannot castle kingside anymore.
+  REQUIRE_FALSE( board.move(Field::e1, Field::g1, PieceType::queen) );
+
+  REQUIRE( board.fromFEN("r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1") );
+  REQUIRE( board.move(Field::a1, Field::a8, PieceType::queen) );
+  REQUIRE_FALSE( board.castling().black_queenside );
+  REQUIRE( board.castling().black_kingside );
+  REQUIRE_FALSE( board.castling().white_queenside );
+  REQUIRE( board.castling().white_kingside );
+}
+
 TEST_CASE("Board::halfmovesFifty()")
 {
   using namespace simplechess;
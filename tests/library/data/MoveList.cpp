@@ -0,0 +1,86 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the test suite for simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../locate_catch.hpp"
+#include "../../../libsimple-chess/data/MoveList.hpp"
+
+TEST_CASE("MoveList")
+{
+  using namespace simplechess;
+
+  SECTION("new list is empty")
+  {
+    MoveList list;
+    REQUIRE( list.empty() );
+    REQUIRE( list.size() == 0 );
+    REQUIRE( list.begin() == list.end() );
+  }
+
+  SECTION("add and clear")
+  {
+    MoveList list;
+    list.add(Move(Field::e2, Field::e4));
+    list.add(Move(Field::a7, Field::a8, PieceType::knight));
+    REQUIRE_FALSE( list.empty() );
+    REQUIRE( list.size() == 2 );
+    REQUIRE( list[0] == Move(Field::e2, Field::e4) );
+    REQUIRE_FALSE( list[0].isPromotion() );
+    REQUIRE( list[1] == Move(Field::a7, Field::a8, PieceType::knight) );
+    REQUIRE( list[1].isPromotion() );
+
+    std::size_t count = 0;
+    for (const Move& m : list)
+    {
+      REQUIRE_FALSE( m.empty() );
+      ++count;
+    }
+    REQUIRE( count == 2 );
+
+    list.clear();
+    REQUIRE( list.empty() );
+    REQUIRE( list.size() == 0 );
+  }
+
+  SECTION("truncate")
+  {
+    MoveList list;
+    list.add(Move(Field::e2, Field::e4));
+    list.add(Move(Field::d2, Field::d4));
+    list.add(Move(Field::c2, Field::c4));
+
+    list.truncate(1);
+    REQUIRE( list.size() == 1 );
+    REQUIRE( list[0] == Move(Field::e2, Field::e4) );
+    REQUIRE( list.end() == list.begin() + 1 );
+
+    list.truncate(0);
+    REQUIRE( list.empty() );
+  }
+
+  SECTION("list can be filled up to its capacity")
+  {
+    MoveList list;
+    for (std::size_t i = 0; i < MoveList::capacity; ++i)
+    {
+      list.add(Move(Field::a1, Field::a2));
+    }
+    REQUIRE( list.size() == MoveList::capacity );
+  }
+}
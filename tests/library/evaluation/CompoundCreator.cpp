@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for simple-chess.
-    Copyright (C) 2018, 2024, 2025  Dirk Stolle
+    Copyright (C) 2018, 2024, 2025, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -137,5 +137,34 @@ TEST_CASE("CompoundCreator")
     // Getting default compound again should not change size.
     CompoundCreator::getDefault(compound);
     REQUIRE( size == compound.size() );
+    // Default evaluators are statically composed.
+    REQUIRE( compound.isFused() );
+  }
+
+  SECTION("common combinations of evaluators are statically composed")
+  {
+    Board board;
+    REQUIRE( board.fromFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1") );
+
+    CompoundEvaluator compound;
+    const std::string evaluators = std::string(CompoundCreator::IdCastling) + ","
+        + std::string(CompoundCreator::IdCheck) + ","
+        + std::string(CompoundCreator::IdPromotion) + ","
+        + std::string(CompoundCreator::IdRootMobility) + ","
+        + std::string(CompoundCreator::IdMaterial);
+    REQUIRE( CompoundCreator::create(evaluators, compound) );
+    REQUIRE( compound.isFused() );
+    const int fusedScore = compound.score(board);
+
+    // Score of the single evaluators must be the same.
+    CompoundEvaluator single;
+    REQUIRE( CompoundCreator::create(evaluators, single) );
+    single.add(std::unique_ptr<Evaluator>(new MaterialEvaluator()));
+    REQUIRE_FALSE( single.isFused() );
+    REQUIRE( single.score(board) == fusedScore + MaterialEvaluator().score(board) );
+
+    // Other combinations use the single evaluators.
+    REQUIRE( CompoundCreator::create(std::string(CompoundCreator::IdCheck), compound) );
+    REQUIRE_FALSE( compound.isFused() );
   }
 }
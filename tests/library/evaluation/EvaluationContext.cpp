@@ -0,0 +1,129 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../locate_catch.hpp"
+#include "../../../libsimple-chess/evaluation/EvaluationContext.hpp"
+#include "../../../libsimple-chess/evaluation/CheckEvaluator.hpp"
+#include "../../../libsimple-chess/evaluation/CompoundCreator.hpp"
+#include "../../../libsimple-chess/evaluation/LinearMobilityEvaluator.hpp"
+#include "../../../libsimple-chess/evaluation/MaterialEvaluator.hpp"
+#include "../../../libsimple-chess/evaluation/StaticCompound.hpp"
+#include "../../../libsimple-chess/rules/check.hpp"
+
+TEST_CASE("EvaluationContext")
+{
+  using namespace simplechess;
+
+  SECTION("default start position")
+  {
+    Board board;
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+    const EvaluationContext context(board);
+
+    REQUIRE( &context.board() == &board );
+    REQUIRE( context.king(Colour::white) == Field::e1 );
+    REQUIRE( context.king(Colour::black) == Field::e8 );
+    REQUIRE( context.kingZone(Colour::white) == (fieldBit(Field::d1) | fieldBit(Field::e1) | fieldBit(Field::f1)
+                                                 | fieldBit(Field::d2) | fieldBit(Field::e2) | fieldBit(Field::f2)) );
+    REQUIRE_FALSE( context.inCheck(Colour::white) );
+    REQUIRE_FALSE( context.inCheck(Colour::black) );
+    REQUIRE_FALSE( context.isCheckMate(Colour::white) );
+    REQUIRE_FALSE( context.isCheckMate(Colour::black) );
+    REQUIRE( context.moveCount(Colour::white) == 20 );
+    REQUIRE( context.moveCount(Colour::black) == 20 );
+
+    // White attacks the whole second and third row, but nothing beyond.
+    const Bitboard whiteAttacks = context.attacks(Colour::white);
+    for (int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
+    {
+      const Field f = static_cast<Field>(i);
+      const int fieldRow = row(f);
+      const bool attacked = (whiteAttacks & fieldBit(f)) != 0;
+      REQUIRE( attacked == ((fieldRow == 2) || (fieldRow == 3) || ((fieldRow == 1) && (f != Field::a1) && (f != Field::h1))) );
+    } // for
+  }
+
+  SECTION("attacks of sliding pieces stop at the first occupied field")
+  {
+    Board board;
+    REQUIRE( board.fromFEN("4k3/8/8/8/1p6/8/8/R3K3 w - - 0 1") );
+    const EvaluationContext context(board);
+
+    const Bitboard attacks = context.attacks(Colour::white);
+    REQUIRE( (attacks & fieldBit(Field::a8)) != 0 );
+    REQUIRE( (attacks & fieldBit(Field::d1)) != 0 );
+    // The king blocks the rook.
+    REQUIRE( (attacks & fieldBit(Field::f1)) != 0 );
+    REQUIRE( (attacks & fieldBit(Field::g1)) == 0 );
+    // The black pawn attacks a3 and c3.
+    REQUIRE( (context.attacks(Colour::black) & fieldBit(Field::a3)) != 0 );
+    REQUIRE( (context.attacks(Colour::black) & fieldBit(Field::c3)) != 0 );
+  }
+
+  SECTION("board without kings")
+  {
+    Board board;
+    REQUIRE( board.fromFEN("8/8/8/3p4/8/8/8/8 w - - 0 1") );
+    const EvaluationContext context(board);
+
+    REQUIRE( context.king(Colour::white) == Field::none );
+    REQUIRE( context.kingZone(Colour::white) == 0 );
+    REQUIRE( context.attacks(Colour::white) == 0 );
+  }
+
+  SECTION("checkmate is the same as isCheckMate()")
+  {
+    Board board;
+    // fool's mate
+    REQUIRE( board.fromFEN("rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPP2P/RNBQKBNR w KQkq - 1 3") );
+    const EvaluationContext context(board);
+
+    REQUIRE( context.inCheck(Colour::white) );
+    REQUIRE( context.isCheckMate(Colour::white) );
+    REQUIRE( context.isCheckMate(Colour::white) == isCheckMate(board, Colour::white) );
+    REQUIRE_FALSE( context.isCheckMate(Colour::black) );
+    // Counting the moves after the checkmate test does not change anything.
+    REQUIRE( context.moveCount(Colour::white) == 0 );
+    REQUIRE( context.isCheckMate(Colour::white) );
+  }
+
+  SECTION("evaluators give the same score with and without context")
+  {
+    const std::string fens[] = {
+      "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      "rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPP2P/RNBQKBNR w KQkq - 1 3",
+      "4k3/8/8/8/8/8/4Q3/4K3 b - - 0 1"
+    };
+    CompoundEvaluator compound;
+    CompoundCreator::getDefault(compound);
+    const StaticCompound<MaterialEvaluator, LinearMobilityEvaluator, CheckEvaluator> staticCompound;
+    for (const auto& fen : fens)
+    {
+      Board board;
+      REQUIRE( board.fromFEN(fen) );
+      const EvaluationContext context(board);
+      REQUIRE( compound.score(board, context) == compound.score(board) );
+      REQUIRE( staticCompound.score(board, context) == staticCompound.score(board) );
+      REQUIRE( staticCompound.score(board) == MaterialEvaluator().score(board)
+               + LinearMobilityEvaluator().score(board) + CheckEvaluator().score(board) );
+    } // for
+  }
+}
@@ -0,0 +1,121 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../locate_catch.hpp"
+#include "../../../libsimple-chess/evaluation/StaticCompound.hpp"
+#include "../../../libsimple-chess/evaluation/CastlingEvaluator.hpp"
+#include "../../../libsimple-chess/evaluation/CheckEvaluator.hpp"
+#include "../../../libsimple-chess/evaluation/CompoundEvaluator.hpp"
+#include "../../../libsimple-chess/evaluation/LinearMobilityEvaluator.hpp"
+#include "../../../libsimple-chess/evaluation/MaterialEvaluator.hpp"
+#include "../../../libsimple-chess/evaluation/PromotionEvaluator.hpp"
+#include "../../../libsimple-chess/evaluation/RootMobilityEvaluator.hpp"
+
+TEST_CASE("StaticCompound: score is the sum of all evaluators")
+{
+  using namespace simplechess;
+
+  const StaticCompound<MaterialEvaluator, LinearMobilityEvaluator,
+      PromotionEvaluator, CheckEvaluator, CastlingEvaluator> fused;
+  CompoundEvaluator dynamic;
+  dynamic.add(std::unique_ptr<Evaluator>(new MaterialEvaluator()));
+  dynamic.add(std::unique_ptr<Evaluator>(new LinearMobilityEvaluator()));
+  dynamic.add(std::unique_ptr<Evaluator>(new PromotionEvaluator()));
+  dynamic.add(std::unique_ptr<Evaluator>(new CheckEvaluator()));
+  dynamic.add(std::unique_ptr<Evaluator>(new CastlingEvaluator()));
+
+  const std::string positions[] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+    "8/8/8/8/8/4K3/4Q3/4k3 b - - 0 1"
+  };
+  Board board;
+  for (const std::string& fen : positions)
+  {
+    REQUIRE( board.fromFEN(fen) );
+    REQUIRE( fused.score(board) == dynamic.score(board) );
+  }
+}
+
+TEST_CASE("StaticCompound: size and name")
+{
+  using namespace simplechess;
+
+  REQUIRE( StaticCompound<MaterialEvaluator>::size() == 1 );
+  REQUIRE( StaticCompound<MaterialEvaluator>().name() == "StaticCompound(MaterialEvaluator)" );
+
+  const StaticCompound<MaterialEvaluator, PromotionEvaluator> compound;
+  REQUIRE( compound.size() == 2 );
+  REQUIRE( compound.name() == "StaticCompound(MaterialEvaluator,PromotionEvaluator)" );
+}
+
+TEST_CASE("StaticCompound: evaluators without context are called directly")
+{
+  using namespace simplechess;
+
+  // Only evaluators with their own score() method for the context get it.
+  // All others are called with score(board), because the inherited method
+  // for the context would call score(board) virtually.
+  static_assert( UsesEvaluationContext<CheckEvaluator>::value );
+  static_assert( UsesEvaluationContext<LinearMobilityEvaluator>::value );
+  static_assert( UsesEvaluationContext<RootMobilityEvaluator>::value );
+  static_assert( !UsesEvaluationContext<MaterialEvaluator>::value );
+  static_assert( !UsesEvaluationContext<PromotionEvaluator>::value );
+  static_assert( !UsesEvaluationContext<CastlingEvaluator>::value );
+
+  // No context is built for evaluators that do not need one.
+  static_assert( !StaticCompound<MaterialEvaluator>::usesContext() );
+  static_assert( !StaticCompound<MaterialEvaluator, PromotionEvaluator, CastlingEvaluator>::usesContext() );
+  static_assert( StaticCompound<MaterialEvaluator, LinearMobilityEvaluator>::usesContext() );
+
+  Board board;
+  REQUIRE( board.fromFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1") );
+  const StaticCompound<MaterialEvaluator, PromotionEvaluator, CastlingEvaluator> compound;
+  const EvaluationContext context(board);
+  REQUIRE( compound.score(board) == compound.score(board, context) );
+  REQUIRE( compound.score(board) == MaterialEvaluator().score(board)
+           + PromotionEvaluator().score(board) + CastlingEvaluator().score(board) );
+}
+
+TEST_CASE("CompoundEvaluator with fused evaluator")
+{
+  using namespace simplechess;
+  Board board;
+  REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNB1KBNR w KQkq - 0 1") );
+
+  CompoundEvaluator evaluator;
+  evaluator.add(std::unique_ptr<Evaluator>(new MaterialEvaluator()));
+  REQUIRE_FALSE( evaluator.isFused() );
+  const int score = evaluator.score(board);
+  evaluator.setFused(std::unique_ptr<Evaluator>(new StaticCompound<MaterialEvaluator>()));
+  REQUIRE( evaluator.isFused() );
+  REQUIRE( evaluator.score(board) == score );
+
+  // Adding another evaluator drops the fused evaluator.
+  evaluator.add(std::unique_ptr<Evaluator>(new LinearMobilityEvaluator()));
+  REQUIRE_FALSE( evaluator.isFused() );
+  evaluator.setFused(std::unique_ptr<Evaluator>(new StaticCompound<MaterialEvaluator, LinearMobilityEvaluator>()));
+  REQUIRE( evaluator.isFused() );
+  // So does clearing the compound.
+  evaluator.clear();
+  REQUIRE_FALSE( evaluator.isFused() );
+  REQUIRE( evaluator.score(board) == 0 );
+}
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for simple-chess.
-    Copyright (C) 2017, 2018  Dirk Stolle
+    Copyright (C) 2017, 2018, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -336,4 +336,53 @@ TEST_CASE("isCheckMate() test")
     REQUIRE_FALSE( isCheckMate(board, Colour::white) );
     REQUIRE( isCheckMate(board, Colour::black) );
   }
+
+  SECTION( "check can be blocked or checking piece can be captured" )
+  {
+    // Back rank check without any help is mate.
+    REQUIRE(board.fromFEN("k7/8/8/8/8/8/5PPP/r5K1 w - - 0 1"));
+    REQUIRE( isCheckMate(board, Colour::white) );
+    // Rook can block the check on d1.
+    REQUIRE(board.fromFEN("k7/8/8/3R4/8/8/5PPP/r5K1 w - - 0 1"));
+    REQUIRE_FALSE( isCheckMate(board, Colour::white) );
+    // Bishop can capture the checking rook.
+    REQUIRE(board.fromFEN("k7/8/8/4B3/8/8/5PPP/r5K1 w - - 0 1"));
+    REQUIRE_FALSE( isCheckMate(board, Colour::white) );
+  }
+
+  SECTION( "double check cannot be blocked" )
+  {
+    REQUIRE(board.fromFEN("k7/8/8/3R4/8/8/4nPPP/r5K1 w - - 0 1"));
+    REQUIRE( isCheckMate(board, Colour::white) );
+  }
+}
+
+TEST_CASE("isStalemate() test")
+{
+  using namespace simplechess;
+  Board board;
+
+  SECTION( "default start position" )
+  {
+    REQUIRE(board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+    REQUIRE_FALSE( isStalemate(board, Colour::white) );
+    REQUIRE_FALSE( isStalemate(board, Colour::black) );
+  }
+
+  SECTION( "black is stalemate" )
+  {
+    REQUIRE(board.fromFEN("k7/8/1Q6/8/8/8/8/7K b - - 0 1"));
+    REQUIRE( isStalemate(board, Colour::black) );
+    REQUIRE_FALSE( isStalemate(board, Colour::white) );
+    REQUIRE_FALSE( isCheckMate(board, Colour::black) );
+    // Only the player to move can be stalemate.
+    board.setToMove(Colour::white);
+    REQUIRE_FALSE( isStalemate(board, Colour::black) );
+  }
+
+  SECTION( "checkmate is no stalemate" )
+  {
+    REQUIRE(board.fromFEN("8/8/8/8/8/4K3/4Q3/4k3 b"));
+    REQUIRE_FALSE( isStalemate(board, Colour::black) );
+  }
 }
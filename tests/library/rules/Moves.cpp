@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for simple-chess.
-    Copyright (C) 2017, 2018  Dirk Stolle
+    Copyright (C) 2017, 2018, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,6 +20,7 @@
 
 
 #include "../../locate_catch.hpp"
+#include <algorithm>
 #include "../../../libsimple-chess/rules/Moves.hpp"
 
 TEST_CASE("Moves::sanitizePromotion() test")
@@ -238,3 +239,279 @@ TEST_CASE("Moves::isPromotion() test")
     REQUIRE_FALSE( Moves::isPromotion(board, Field::h7, Field::h6) );
   }
 }
+
+TEST_CASE("Moves::generate()")
+{
+  using namespace simplechess;
+  Board board;
+  MoveList moves;
+
+  SECTION("start position")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+    Moves::generate(board, moves);
+    REQUIRE( moves.size() == 20 );
+
+    board.setToMove(Colour::black);
+    Moves::generate(board, moves);
+    REQUIRE( moves.size() == 20 );
+  }
+
+  SECTION("checkmate: no moves")
+  {
+    REQUIRE( board.fromFEN("rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPP2P/RNBQKBNR w KQkq - 1 3") );
+    Moves::generate(board, moves);
+    REQUIRE( moves.empty() );
+  }
+
+  SECTION("stalemate: no moves")
+  {
+    REQUIRE( board.fromFEN("7k/5Q2/6K1/8/8/8/8/8 b - - 0 1") );
+    Moves::generate(board, moves);
+    REQUIRE( moves.empty() );
+  }
+
+  SECTION("promotions are listed once per promotion piece")
+  {
+    REQUIRE( board.fromFEN("1r5k/P7/8/8/8/8/8/7K w - - 0 1") );
+    Moves::generate(board, moves);
+    // three king moves, four promotions on a8 and four promotions on b8
+    REQUIRE( moves.size() == 11 );
+    const auto promotions = std::count_if(moves.begin(), moves.end(),
+        [](const Move& m) { return m.isPromotion(); });
+    REQUIRE( promotions == 8 );
+    for (const auto promo : { PieceType::queen, PieceType::rook, PieceType::bishop, PieceType::knight })
+    {
+      REQUIRE( std::find(moves.begin(), moves.end(), Move(Field::a7, Field::a8, promo)) != moves.end() );
+      REQUIRE( std::find(moves.begin(), moves.end(), Move(Field::a7, Field::b8, promo)) != moves.end() );
+    }
+  }
+
+  SECTION("generated moves are exactly the allowed moves")
+  {
+    const auto positions = {
+      "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R b KQkq - 0 1",
+      "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+      "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+      "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+      "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 b kq - 0 1",
+      "4k3/8/8/8/8/8/4r3/R3K3 w - - 0 1"
+    };
+    for (const auto fen : positions)
+    {
+      REQUIRE( board.fromFEN(fen) );
+      Moves::generate(board, moves);
+      std::size_t expected = 0;
+      for (int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
+      {
+        const Field from = static_cast<Field>(i);
+        if (board.element(from).colour() != board.toMove())
+          continue;
+        for (int j = static_cast<int>(Field::a1); j <= static_cast<int>(Field::h8); ++j)
+        {
+          const Field to = static_cast<Field>(j);
+          if (!Moves::isAllowed(board, from, to))
+            continue;
+          const PieceType promo = Moves::isPromotion(board, from, to) ? PieceType::queen : PieceType::none;
+          REQUIRE( std::find(moves.begin(), moves.end(), Move(from, to, promo)) != moves.end() );
+          expected += Moves::isPromotion(board, from, to) ? 4 : 1;
+        } // for j
+      } // for i
+      REQUIRE( moves.size() == expected );
+    } // for
+  }
+}
+
+/** \brief Counts the leaf nodes of the move tree up to a given depth.
+ *
+ * \param board  the position, will be restored after the call
+ * \param depth  remaining depth
+ * \return Returns the number of leaf nodes.
+ */
+std::uint64_t perft(simplechess::Board& board, const unsigned int depth)
+{
+  using namespace simplechess;
+  MoveList moves;
+  Moves::generate(board, moves);
+  if (depth == 1)
+    return moves.size();
+  std::uint64_t nodes = 0;
+  UndoRecord undo;
+  for (const Move& move : moves)
+  {
+    board.makeMove(move.from, move.to, move.promoteTo, undo);
+    nodes += perft(board, depth - 1);
+    board.unmakeMove(move.from, move.to, undo);
+  }
+  return nodes;
+}
+
+TEST_CASE("Moves::generate(): perft")
+{
+  using namespace simplechess;
+  Board board;
+
+  SECTION("start position")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+    REQUIRE( perft(board, 1) == 20 );
+    REQUIRE( perft(board, 2) == 400 );
+    REQUIRE( perft(board, 3) == 8902 );
+  }
+
+  SECTION("position with en passant and promotions")
+  {
+    // perft values of this position are well known from other engines
+    REQUIRE( board.fromFEN("8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1") );
+    REQUIRE( perft(board, 1) == 14 );
+    REQUIRE( perft(board, 2) == 191 );
+    REQUIRE( perft(board, 3) == 2812 );
+  }
+}
+
+TEST_CASE("Moves::generateCaptures()")
+{
+  using namespace simplechess;
+  Board board;
+  MoveList moves;
+
+  SECTION("start position has no captures")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+    Moves::generateCaptures(board, moves);
+    REQUIRE( moves.empty() );
+  }
+
+  SECTION("captures are a subset of all moves")
+  {
+    const std::vector<std::string> positions = {
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R b KQkq - 0 1",
+      "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+      "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+      "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1"
+    };
+    for (const auto& fen : positions)
+    {
+      REQUIRE( board.fromFEN(fen) );
+      MoveList all;
+      Moves::generate(board, all);
+      Moves::generateCaptures(board, moves);
+      REQUIRE_FALSE( moves.empty() );
+      // Every capture or queen promotion of the full list is in the capture
+      // list and vice versa.
+      std::size_t expected = 0;
+      for (const Move& move : all)
+      {
+        const bool capture = (board.element(move.to).piece() != PieceType::none)
+            || ((move.to == board.enPassant()) && (board.element(move.from).piece() == PieceType::pawn));
+        const bool queenPromotion = move.promoteTo == PieceType::queen;
+        const bool underPromotion = move.isPromotion() && !queenPromotion;
+        if ((capture || queenPromotion) && !underPromotion)
+        {
+          ++expected;
+          REQUIRE( std::find(moves.begin(), moves.end(), move) != moves.end() );
+        }
+      }
+      REQUIRE( moves.size() == expected );
+    }
+  }
+
+  SECTION("en passant capture is included")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3") );
+    Moves::generateCaptures(board, moves);
+    REQUIRE( moves.size() == 1 );
+    REQUIRE( moves[0] == Move(Field::e5, Field::f6) );
+  }
+
+  SECTION("pawns on the last row have no field ahead")
+  {
+    // Such positions cannot occur in a game, but the FEN may contain them.
+    REQUIRE( board.fromFEN("4k2P/8/8/8/8/8/8/p3K3 w - - 0 1") );
+    Moves::generateCaptures(board, moves);
+    REQUIRE( moves.empty() );
+
+    REQUIRE( board.fromFEN("4k2P/8/8/8/8/8/8/p3K3 b - - 0 1") );
+    Moves::generateCaptures(board, moves);
+    REQUIRE( moves.empty() );
+  }
+}
+
+TEST_CASE("Moves::count()")
+{
+  using namespace simplechess;
+  Board board;
+
+  SECTION("start position")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+    REQUIRE( Moves::count(board, Colour::white) == 20 );
+    REQUIRE( Moves::count(board, Colour::black) == 20 );
+  }
+
+  SECTION("count matches the generated moves")
+  {
+    const std::vector<std::string> positions = {
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+      "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+      "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+      "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+      // en passant capture would expose the king on the fifth row
+      "8/8/8/K1pP3r/8/8/8/7k w - c6 0 1",
+      // double check, and a pinned knight
+      "4k3/8/8/8/1b6/8/3N4/r3K3 w - - 0 1",
+      // pinned rook may move along the pin
+      "4k3/4r3/8/8/8/8/4R3/4K3 w - - 0 1",
+      // no kings at all
+      "8/8/3q4/8/8/2N5/8/8 w - - 0 1"
+    };
+    for (const auto& fen : positions)
+    {
+      REQUIRE( board.fromFEN(fen) );
+      for (const Colour colour : { Colour::white, Colour::black })
+      {
+        Board work(board);
+        work.setToMove(colour);
+        MoveList moves;
+        Moves::generate(work, moves);
+        int expected = 0;
+        for (const Move& move : moves)
+        {
+          if ((move.promoteTo == PieceType::none) || (move.promoteTo == PieceType::queen))
+            ++expected;
+        }
+        REQUIRE( Moves::count(board, colour) == expected );
+      }
+    }
+  }
+}
+
+TEST_CASE("Moves::hasAllowedMove()")
+{
+  using namespace simplechess;
+  Board board;
+
+  SECTION("start position")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+    REQUIRE( Moves::hasAllowedMove(board, Colour::white) );
+    REQUIRE( Moves::hasAllowedMove(board, Colour::black) );
+  }
+
+  SECTION("checkmate")
+  {
+    REQUIRE( board.fromFEN("k7/8/8/8/8/8/5PPP/r5K1 w - - 0 1") );
+    REQUIRE_FALSE( Moves::hasAllowedMove(board, Colour::white) );
+    REQUIRE( Moves::hasAllowedMove(board, Colour::black) );
+  }
+
+  SECTION("stalemate")
+  {
+    REQUIRE( board.fromFEN("k7/8/1Q6/8/8/8/8/7K b - - 0 1") );
+    REQUIRE_FALSE( Moves::hasAllowedMove(board, Colour::black) );
+  }
+}
@@ -0,0 +1,187 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the test suite for simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../locate_catch.hpp"
+#include <random>
+#include "../../../libsimple-chess/rules/attacks.hpp"
+#include "../../../libsimple-chess/rules/check.hpp"
+#include "../../../libsimple-chess/rules/Moves.hpp"
+
+/** \brief Gets the fields to which a piece on an otherwise empty board can move
+ *         according to Moves::isAllowedPattern().
+ */
+simplechess::Bitboard patternTargets(const simplechess::Piece piece, const simplechess::Field from)
+{
+  using namespace simplechess;
+  Board board;
+  REQUIRE( board.setElement(from, piece) );
+  board.setToMove(piece.colour());
+  // castling is not an attack
+  Castling noCastling;
+  noCastling.white_kingside = false;
+  noCastling.white_queenside = false;
+  noCastling.black_kingside = false;
+  noCastling.black_queenside = false;
+  board.setCastling(noCastling);
+  Bitboard result = 0;
+  for (int j = static_cast<int>(Field::a1); j <= static_cast<int>(Field::h8); ++j)
+  {
+    if (Moves::isAllowedPattern(board, from, static_cast<Field>(j)))
+      result |= fieldBit(static_cast<Field>(j));
+  }
+  return result;
+}
+
+TEST_CASE("attack tables for knight and king")
+{
+  using namespace simplechess;
+
+  for (int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
+  {
+    const Field f = static_cast<Field>(i);
+    REQUIRE( knightAttacks(f) == patternTargets(Piece(Colour::white, PieceType::knight), f) );
+    REQUIRE( kingAttacks(f) == patternTargets(Piece(Colour::black, PieceType::king), f) );
+  }
+
+  REQUIRE( popCount(knightAttacks(Field::a1)) == 2 );
+  REQUIRE( popCount(knightAttacks(Field::d4)) == 8 );
+  REQUIRE( popCount(kingAttacks(Field::h8)) == 3 );
+  REQUIRE( popCount(kingAttacks(Field::e4)) == 8 );
+}
+
+TEST_CASE("attack tables for pawns")
+{
+  using namespace simplechess;
+
+  REQUIRE( pawnAttacks(Colour::white, Field::e4) == (fieldBit(Field::d5) | fieldBit(Field::f5)) );
+  REQUIRE( pawnAttacks(Colour::black, Field::e4) == (fieldBit(Field::d3) | fieldBit(Field::f3)) );
+  REQUIRE( pawnAttacks(Colour::white, Field::a2) == fieldBit(Field::b3) );
+  REQUIRE( pawnAttacks(Colour::white, Field::h2) == fieldBit(Field::g3) );
+  REQUIRE( pawnAttacks(Colour::black, Field::a7) == fieldBit(Field::b6) );
+  REQUIRE( pawnAttacks(Colour::black, Field::h7) == fieldBit(Field::g6) );
+  REQUIRE( pawnAttacks(Colour::white, Field::c8) == 0 );
+  REQUIRE( pawnAttacks(Colour::black, Field::c1) == 0 );
+}
+
+TEST_CASE("sliding attacks on empty board")
+{
+  using namespace simplechess;
+
+  for (int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
+  {
+    const Field f = static_cast<Field>(i);
+    REQUIRE( rookAttacks(f, 0) == patternTargets(Piece(Colour::white, PieceType::rook), f) );
+    REQUIRE( bishopAttacks(f, 0) == patternTargets(Piece(Colour::white, PieceType::bishop), f) );
+    REQUIRE( queenAttacks(f, 0) == patternTargets(Piece(Colour::white, PieceType::queen), f) );
+  }
+}
+
+TEST_CASE("attackersOf()")
+{
+  using namespace simplechess;
+  Board board;
+  const auto positions = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"
+  };
+  for (const auto fen : positions)
+  {
+    REQUIRE( board.fromFEN(fen) );
+    // On fields occupied by the opponent attacks are the same as allowed
+    // move patterns.
+    for (const auto by : { Colour::white, Colour::black })
+    {
+      const Colour opponent = (by == Colour::white) ? Colour::black : Colour::white;
+      Bitboard targets = board.pieces(opponent);
+      while (targets != 0)
+      {
+        const Field f = popFirstField(targets);
+        const Bitboard attackers = attackersOf(board, f, board.occupied());
+        REQUIRE( ((attackers & board.pieces(by)) != 0) == isUnderAttack(board, by, f) );
+      }
+    }
+  }
+}
+
+TEST_CASE("sliding attack tables match ray based attacks")
+{
+  using namespace simplechess;
+
+  std::mt19937_64 generator(12345);
+  for (int i = static_cast<int>(Field::a1); i <= static_cast<int>(Field::h8); ++i)
+  {
+    const Field f = static_cast<Field>(i);
+    for (int k = 0; k < 500; ++k)
+    {
+      // sparse and dense occupancies
+      const Bitboard occupied = (k % 2 == 0) ? (generator() & generator()) : (generator() | generator());
+      REQUIRE( rookAttacks(f, occupied) == rookAttacksSlow(f, occupied) );
+      REQUIRE( bishopAttacks(f, occupied) == bishopAttacksSlow(f, occupied) );
+    }
+  }
+}
+
+TEST_CASE("sliding attacks match move patterns")
+{
+  using namespace simplechess;
+  Board board;
+  const auto positions = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "2q5/6b1/1r6/3Q4/8/1B3R2/8/8 w - - 0 1"
+  };
+  for (const auto fen : positions)
+  {
+    REQUIRE( board.fromFEN(fen) );
+    for (const auto type : { PieceType::rook, PieceType::bishop, PieceType::queen })
+    {
+      Bitboard pieces = board.pieces(type);
+      while (pieces != 0)
+      {
+        const Field from = popFirstField(pieces);
+        Bitboard expected = 0;
+        for (int j = static_cast<int>(Field::a1); j <= static_cast<int>(Field::h8); ++j)
+        {
+          if (Moves::isAllowedPattern(board, from, static_cast<Field>(j)))
+            expected |= fieldBit(static_cast<Field>(j));
+        }
+        Bitboard attacks = 0;
+        switch (type)
+        {
+          case PieceType::rook:
+               attacks = rookAttacks(from, board.occupied());
+               break;
+          case PieceType::bishop:
+               attacks = bishopAttacks(from, board.occupied());
+               break;
+          default:
+               attacks = queenAttacks(from, board.occupied());
+               break;
+        }
+        const Colour own = board.element(from).colour();
+        REQUIRE( (attacks & ~board.pieces(own)) == expected );
+      } // while
+    } // for type
+  } // for fen
+}
@@ -0,0 +1,110 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "../../locate_catch.hpp"
+#include "../../../libsimple-chess/rules/exchange.hpp"
+
+TEST_CASE("static exchange evaluation")
+{
+  using namespace simplechess;
+  Board board;
+
+  SECTION("capture of undefended piece wins the piece")
+  {
+    REQUIRE( board.fromFEN("4k3/8/8/4n3/8/8/8/4RK2 w - - 0 1") );
+    const Move move(Field::e1, Field::e5);
+    REQUIRE( see(board, move) == 300 );
+    REQUIRE_FALSE( losesMaterial(board, move) );
+  }
+
+  SECTION("pawn takes defended knight")
+  {
+    REQUIRE( board.fromFEN("4k3/5p2/4n3/3P4/8/8/8/4K3 w - - 0 1") );
+    const Move move(Field::d5, Field::e6);
+    REQUIRE( see(board, move) == 200 );
+    REQUIRE_FALSE( losesMaterial(board, move) );
+  }
+
+  SECTION("queen takes defended pawn")
+  {
+    REQUIRE( board.fromFEN("4k3/8/3p4/4p3/8/8/8/4QK2 w - - 0 1") );
+    const Move move(Field::e1, Field::e5);
+    REQUIRE( see(board, move) == -800 );
+    REQUIRE( losesMaterial(board, move) );
+  }
+
+  SECTION("x-ray attacker behind rook joins the exchange")
+  {
+    // Rxe5 Rxe5 Rxe5 wins a pawn, but only because of the second white rook.
+    REQUIRE( board.fromFEN("4r1k1/8/8/4p3/8/8/4R3/4R1K1 w - - 0 1") );
+    const Move move(Field::e2, Field::e5);
+    REQUIRE( see(board, move) == 100 );
+    REQUIRE_FALSE( losesMaterial(board, move) );
+
+    // Without it the rook is lost for a pawn.
+    REQUIRE( board.fromFEN("4r1k1/8/8/4p3/8/8/4R3/6K1 w - - 0 1") );
+    REQUIRE( see(board, move) == -400 );
+    REQUIRE( losesMaterial(board, move) );
+  }
+
+  SECTION("x-ray attacker behind bishop joins the exchange")
+  {
+    // Bxd5 Nxd5 Qxd5 wins a knight for a bishop.
+    REQUIRE( board.fromFEN("4k3/4n3/8/3n4/8/1B6/Q7/4K3 w - - 0 1") );
+    const Move move(Field::b3, Field::d5);
+    REQUIRE( see(board, move) == 300 - 325 + 300 );
+  }
+
+  SECTION("player stops capturing when going on loses material")
+  {
+    // Nxe5 dxe5 would lose the knight for a pawn, so black does not
+    // recapture with the queen behind the pawn.
+    REQUIRE( board.fromFEN("3qk3/8/3p4/4p3/8/5N2/8/4K3 w - - 0 1") );
+    const Move move(Field::f3, Field::e5);
+    REQUIRE( see(board, move) == 100 - 300 );
+    REQUIRE( losesMaterial(board, move) );
+  }
+
+  SECTION("king does not capture defended piece")
+  {
+    REQUIRE( board.fromFEN("8/8/8/8/8/3k4/3p4/3RK3 w - - 0 1") );
+    const Move move(Field::d1, Field::d2);
+    REQUIRE( see(board, move) == 100 );
+  }
+
+  SECTION("en passant capture")
+  {
+    REQUIRE( board.fromFEN("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1") );
+    const Move move(Field::e5, Field::d6);
+    REQUIRE( see(board, move) == 100 );
+    REQUIRE_FALSE( losesMaterial(board, move) );
+  }
+
+  SECTION("promotion gains the value of the new piece")
+  {
+    REQUIRE( board.fromFEN("4k3/1P6/8/8/8/8/8/4K3 w - - 0 1") );
+    const Move move(Field::b7, Field::b8, PieceType::queen);
+    REQUIRE( see(board, move) == 800 );
+    // Promotion on a defended field loses the pawn.
+    REQUIRE( board.fromFEN("2k5/1P6/8/8/8/8/8/4K3 w - - 0 1") );
+    REQUIRE( see(board, move) == -100 );
+    REQUIRE( losesMaterial(board, move) );
+  }
+}
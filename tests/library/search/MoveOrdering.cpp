@@ -0,0 +1,172 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the test suite for simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+
+
+#include "../../locate_catch.hpp"
+#include <algorithm>
+#include "../../../libsimple-chess/rules/Moves.hpp"
+#include "../../../libsimple-chess/search/MoveOrdering.hpp"
+
+TEST_CASE("MoveOrdering")
+{
+  using namespace simplechess;
+  Board board;
+  MoveList moves;
+  MoveOrdering ordering;
+
+  SECTION("hash move comes first")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+    Moves::generate(board, moves);
+    const Move hashMove(Field::g1, Field::f3);
+    ordering.order(board, moves, hashMove, 0);
+    REQUIRE( moves.size() == 20 );
+    REQUIRE( moves[0] == hashMove );
+  }
+
+  SECTION("captures are ordered by MVV-LVA")
+  {
+    // White can capture the queen on d5 with the pawn or one of the knights,
+    // and the rook on h5 with the knight on f4.
+    REQUIRE( board.fromFEN("4k3/8/8/3q3r/4PN2/2N5/8/4K3 w - - 0 1") );
+    Moves::generate(board, moves);
+    ordering.order(board, moves, Move(), 0);
+    // Pawn takes queen is the best capture.
+    REQUIRE( moves[0] == Move(Field::e4, Field::d5) );
+    // Then the knights take the queen.
+    REQUIRE( moves[1].to == Field::d5 );
+    REQUIRE( moves[2].to == Field::d5 );
+    // Then the rook is captured.
+    REQUIRE( moves[3] == Move(Field::f4, Field::h5) );
+    // Quiet moves come after all captures.
+    for (std::size_t i = 4; i < moves.size(); ++i)
+    {
+      REQUIRE_FALSE( MoveOrdering::isTactical(board, moves[i]) );
+    }
+  }
+
+  SECTION("killer moves come before other quiet moves")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+    const Move killer(Field::b1, Field::c3);
+    ordering.cutoff(board, killer, 3, 2);
+    REQUIRE( ordering.isKiller(killer, 2) );
+    REQUIRE_FALSE( ordering.isKiller(killer, 1) );
+
+    Moves::generate(board, moves);
+    ordering.order(board, moves, Move(), 2);
+    REQUIRE( moves[0] == killer );
+
+    // A newer killer move is tried before the older one.
+    const Move newer(Field::e2, Field::e4);
+    ordering.cutoff(board, newer, 3, 2);
+    ordering.order(board, moves, Move(), 2);
+    REQUIRE( moves[0] == newer );
+    REQUIRE( moves[1] == killer );
+  }
+
+  SECTION("history orders quiet moves")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+    const Move often(Field::d2, Field::d4);
+    const Move rarely(Field::c2, Field::c4);
+    // Cut-offs at high ply do not produce killers, only history.
+    ordering.cutoff(board, often, 5, MoveOrdering::maxPly);
+    ordering.cutoff(board, rarely, 2, MoveOrdering::maxPly);
+    REQUIRE( ordering.history(Colour::white, often) == 25 );
+    REQUIRE( ordering.history(Colour::white, rarely) == 4 );
+    REQUIRE( ordering.history(Colour::black, often) == 0 );
+
+    Moves::generate(board, moves);
+    ordering.order(board, moves, Move(), 0);
+    REQUIRE( moves[0] == often );
+    REQUIRE( moves[1] == rarely );
+
+    ordering.clear();
+    REQUIRE( ordering.history(Colour::white, often) == 0 );
+  }
+
+  SECTION("aging moves killers closer to the root and halves history")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+    const Move killer(Field::b1, Field::c3);
+    ordering.cutoff(board, killer, 3, 3);
+    ordering.cutoff(board, Move(Field::g1, Field::f3), 2, 1);
+    REQUIRE( ordering.history(Colour::white, killer) == 9 );
+
+    ordering.age(2);
+    REQUIRE( ordering.isKiller(killer, 1) );
+    REQUIRE_FALSE( ordering.isKiller(killer, 3) );
+    REQUIRE_FALSE( ordering.isKiller(Move(Field::g1, Field::f3), 1) );
+    REQUIRE( ordering.history(Colour::white, killer) == 4 );
+  }
+
+  SECTION("losing captures come after killer moves")
+  {
+    // Pawn takes knight wins material, queen takes pawn loses the queen.
+    REQUIRE( board.fromFEN("4k3/8/3p4/4p3/3n4/2P5/8/4QK2 w - - 0 1") );
+    const Move killer(Field::f1, Field::g1);
+    ordering.cutoff(board, killer, 3, 0);
+
+    Moves::generate(board, moves);
+    ordering.order(board, moves, Move(), 0);
+    REQUIRE( moves[0] == Move(Field::c3, Field::d4) );
+    REQUIRE( moves[1] == killer );
+    REQUIRE( moves[2] == Move(Field::e1, Field::e5) );
+    for (std::size_t i = 3; i < moves.size(); ++i)
+    {
+      REQUIRE_FALSE( MoveOrdering::isTactical(board, moves[i]) );
+    }
+  }
+
+  SECTION("orderCaptures removes losing captures")
+  {
+    // Pawn takes knight wins material, queen takes pawn loses the queen.
+    REQUIRE( board.fromFEN("4k3/8/3p4/4p3/3n4/2P5/8/4QK2 w - - 0 1") );
+    Moves::generateCaptures(board, moves);
+    REQUIRE( moves.size() == 2 );
+
+    MoveOrdering::orderCaptures(board, moves);
+    REQUIRE( moves.size() == 1 );
+    REQUIRE( moves[0] == Move(Field::c3, Field::d4) );
+  }
+
+  SECTION("orderCaptures sorts by MVV-LVA")
+  {
+    REQUIRE( board.fromFEN("4k3/8/8/3q3r/4PN2/2N5/8/4K3 w - - 0 1") );
+    Moves::generateCaptures(board, moves);
+    REQUIRE( moves.size() == 4 );
+
+    MoveOrdering::orderCaptures(board, moves);
+    REQUIRE( moves.size() == 4 );
+    REQUIRE( moves[0] == Move(Field::e4, Field::d5) );
+    REQUIRE( moves[3] == Move(Field::f4, Field::h5) );
+  }
+
+  SECTION("captures do not become killers")
+  {
+    REQUIRE( board.fromFEN("4k3/8/8/3q3r/4PN2/2N5/8/4K3 w - - 0 1") );
+    const Move capture(Field::e4, Field::d5);
+    ordering.cutoff(board, capture, 4, 1);
+    REQUIRE_FALSE( ordering.isKiller(capture, 1) );
+    REQUIRE( ordering.history(Colour::white, capture) == 0 );
+  }
+}
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the test suite for simple-chess.
-    Copyright (C) 2017, 2018, 2025  Dirk Stolle
+    Copyright (C) 2017, 2018, 2025, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,6 +19,7 @@
 */
 
 
+#include <thread>
 #include "../../locate_catch.hpp"
 #include "../../../libsimple-chess/evaluation/CompoundCreator.hpp"
 #include "../../../libsimple-chess/evaluation/CompoundEvaluator.hpp"
@@ -41,39 +42,24 @@ TEST_CASE("Search")
     evaluator.add(std::unique_ptr<Evaluator>(new LinearMobilityEvaluator()));
     simplechess::Search s(board);
     REQUIRE( s.depth() == 0 );
+    REQUIRE_FALSE( s.hasMove() );
     s.search(evaluator, 1);
     REQUIRE( s.depth() == 1 );
-    const Node& searchNode = s.rootNode();
 
-    // There should be some child nodes.
-    REQUIRE_FALSE( searchNode.children.empty() );
-    // ... and that means the search has some moves.
+    // The search should have found some moves.
     REQUIRE( s.hasMove() );
-    // Number of child nodes should be 20, because there are 20 possible moves.
-    REQUIRE( searchNode.children.size() == 20 );
-    // Child nodes should be ordered by score.
-    for (std::size_t i = 0; i < searchNode.children.size() - 1; ++i)
-    {
-      for (std::size_t j = i + 1; j < searchNode.children.size(); ++j)
-      {
-        REQUIRE( searchNode.children[i]->score <= searchNode.children[j]->score );
-      } // for j
-    } // for i
-
-    // Score of first node should be less than that of the last node.
-    REQUIRE( searchNode.children.front()->score < searchNode.children.back()->score );
-
-    // Child nodes of child nodes should be empty, because depth is only one.
-    for(const auto& child : searchNode.children)
-    {
-      REQUIRE( child->children.empty() );
-    }
+    // Root node plus the positions after the 20 possible moves. Some of them
+    // are searched twice, if they fail high in the null window search.
+    REQUIRE( s.nodes() >= 21 );
+    REQUIRE( s.nodes() < 41 );
 
     // There must be a best move, i.e. its members must not equal none.
     const auto bestMove = s.bestMove();
     REQUIRE( std::get<0>(bestMove) != Field::none );
     REQUIRE( std::get<1>(bestMove) != Field::none );
     REQUIRE( std::get<2>(bestMove) != PieceType::none );
+    // The best move has to be an allowed move.
+    REQUIRE( board.move(std::get<0>(bestMove), std::get<1>(bestMove), std::get<2>(bestMove)) );
   }
 
   SECTION("default start position with depth == 2")
@@ -87,46 +73,42 @@ TEST_CASE("Search")
     REQUIRE( s.depth() == 0 );
     s.search(evaluator, 2);
     REQUIRE( s.depth() == 2 );
-    const Node& searchNode = s.rootNode();
 
-    // There should be some child nodes.
-    REQUIRE_FALSE( searchNode.children.empty() );
-    // ... and that means the search has some moves.
+    // The search should have found some moves.
     REQUIRE( s.hasMove() );
-    // Number of child nodes should be 20, because there are 20 possible moves.
-    REQUIRE( searchNode.children.size() == 20 );
-    // Child nodes should be ordered by score.
-    for (std::size_t i = 0; i < searchNode.children.size() - 1; ++i)
-    {
-      for (std::size_t j = i + 1; j < searchNode.children.size(); ++j)
-      {
-        REQUIRE( searchNode.children[i]->score <= searchNode.children[j]->score );
-      } // for j
-    } // for i
-
-    // Child nodes of child nodes should not be empty, because depth is two.
-    for(const auto& child : searchNode.children)
-    {
-      REQUIRE_FALSE( child->children.empty() );
-
-      // Child nodes of child should be ordered by score, too.
-      for (std::size_t i = 0; i < child->children.size() - 1; ++i)
-      {
-        for (std::size_t j = i + 1; j < child->children.size(); ++j)
-        {
-          REQUIRE( child->children[i]->score <= child->children[j]->score );
-        } // for j
-      } // for i
-    } // outer for
+    // Alpha-beta search has to visit less nodes than the full tree, which
+    // consists of 1 + 20 + 20 * 20 = 421 nodes.
+    REQUIRE( s.nodes() > 21 );
+    REQUIRE( s.nodes() < 421 );
 
     // There must be a best move, i.e. its members must not equal none.
     const auto bestMove = s.bestMove();
     REQUIRE( std::get<0>(bestMove) != Field::none );
     REQUIRE( std::get<1>(bestMove) != Field::none );
     REQUIRE( std::get<2>(bestMove) != PieceType::none );
+    // The best move has to be an allowed move.
+    REQUIRE( board.move(std::get<0>(bestMove), std::get<1>(bestMove), std::get<2>(bestMove)) );
+  }
+
+  SECTION("depth == 3 finds checkmate in two plys")
+  {
+    // Black can checkmate with Qh4# after 1. f3 e5 2. g4.
+    REQUIRE( board.fromFEN("rnbqkbnr/pppp1ppp/8/4p3/6P1/5P2/PPPPP2P/RNBQKBNR b KQkq g3 0 2") );
+
+    CompoundEvaluator evaluator;
+    evaluator.add(std::unique_ptr<Evaluator>(new MaterialEvaluator()));
+    simplechess::Search s(board);
+    s.search(evaluator, 3);
+    REQUIRE( s.depth() == 3 );
+    REQUIRE( s.hasMove() );
+    const auto bestMove = s.bestMove();
+    REQUIRE( std::get<0>(bestMove) == Field::d8 );
+    REQUIRE( std::get<1>(bestMove) == Field::h4 );
+    // Score must indicate a mate after one ply.
+    REQUIRE( s.score() == Search::mateScore - 1 );
   }
 
-  SECTION("Search tree results must not put player in check")
+  SECTION("Search results must not put player in check")
   {
     // This is a regression test for a scenario that occurred when the cli was
     // started with the position given below and black to move. Instead of moving
@@ -149,20 +131,13 @@ TEST_CASE("Search")
     REQUIRE( s.depth() == 0 );
     s.search(evaluator, 1);
     REQUIRE( s.depth() == 1 );
-    const Node& searchNode = s.rootNode();
-    bool found = false;
-    // In each child position, black must not be in check anymore.
-    for(const auto& child : searchNode.children)
-    {
-      // Must not be in check.
-      REQUIRE_FALSE( child->board.isInCheck(Colour::black) );
-      // Find move c2-c1 in list.
-      if ((child->origin == Field::c2) && (child->destination == Field::c1))
-        found = true;
-    } // for
-
-    // Move c2-c1 must not be in list.
-    REQUIRE_FALSE( found );
+    REQUIRE( s.hasMove() );
+    const auto bestMove = s.bestMove();
+    // Move c2-c1 must not be the best move.
+    REQUIRE_FALSE( ((std::get<0>(bestMove) == Field::c2) && (std::get<1>(bestMove) == Field::c1)) );
+    // After the move, black must not be in check anymore.
+    REQUIRE( board.move(std::get<0>(bestMove), std::get<1>(bestMove), std::get<2>(bestMove)) );
+    REQUIRE_FALSE( board.isInCheck(Colour::black) );
   }
 
   SECTION("Search: Use of proper pawn promotion options")
@@ -193,4 +168,429 @@ TEST_CASE("Search")
     REQUIRE( from == Field::f7 );
     REQUIRE( to == Field::f8 );
   }
+
+  SECTION("shared transposition table speeds up repeated search")
+  {
+    REQUIRE( board.fromFEN("r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3") );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    TranspositionTable table(1);
+    simplechess::Search first(board, table);
+    first.search(evaluator, 3);
+    REQUIRE( first.hasMove() );
+
+    simplechess::Search second(board, table);
+    second.search(evaluator, 3);
+    REQUIRE( second.hasMove() );
+    // The second search finds the results of the first one in the table.
+    REQUIRE( second.nodes() < first.nodes() );
+    REQUIRE( second.bestMove() == first.bestMove() );
+    REQUIRE( second.score() == first.score() );
+  }
+
+  SECTION("predicted variation provides moves for the transposition table")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") );
+
+    TranspositionTable table(1);
+    simplechess::Search s(board, table);
+    const Move first(Field::e2, Field::e4);
+    const Move second(Field::e7, Field::e5);
+    // Illegal move ends the line, so the last move is not stored.
+    const Move illegal(Field::e4, Field::e6);
+    const Move last(Field::g1, Field::f3);
+    s.usePredictedVariation({ first, second, illegal, last });
+
+    TranspositionTable::Entry entry;
+    REQUIRE( table.probe(board.hash(), entry) );
+    REQUIRE( entry.move == first );
+    REQUIRE( entry.bound == Bound::none );
+    REQUIRE( board.move(first.from, first.to, first.promoteTo) );
+    REQUIRE( table.probe(board.hash(), entry) );
+    REQUIRE( entry.move == second );
+    REQUIRE( board.move(second.from, second.to, second.promoteTo) );
+    REQUIRE( board.move(illegal.from, illegal.to, illegal.promoteTo) == false );
+    REQUIRE_FALSE( table.probe(board.hash(), entry) );
+  }
+
+  SECTION("aspiration windows do not change the score")
+  {
+    REQUIRE( board.fromFEN("r1bq1rk1/pp2bppp/2n1pn2/3p4/2PP4/2N1PN2/PP3PPP/R2QKB1R w KQ - 0 8") );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    // The selective search depends on the results of earlier iterations, so
+    // it is turned off to get comparable scores.
+    SearchOptions options;
+    options.nullMovePruning = false;
+    options.lateMoveReductions = false;
+    options.futilityPruning = false;
+    options.razoring = false;
+    // Iterative deepening uses aspiration windows from the fourth ply on, ...
+    simplechess::Search deepening(board);
+    deepening.setOptions(options);
+    SearchLimits limits;
+    limits.depth = 5;
+    deepening.search(evaluator, limits);
+    REQUIRE( deepening.depth() == 5 );
+    // ... but a single search to a fixed depth uses the full window.
+    simplechess::Search fixed(board);
+    fixed.setOptions(options);
+    fixed.search(evaluator, 5);
+    REQUIRE( fixed.depth() == 5 );
+    REQUIRE( deepening.score() == fixed.score() );
+  }
+
+  SECTION("selective search visits fewer nodes")
+  {
+    REQUIRE( board.fromFEN("r1bq1rk1/pp2bppp/2n1pn2/3p4/2PP4/2N1PN2/PP3PPP/R2QKB1R w KQ - 0 8") );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    SearchLimits limits;
+    limits.depth = 5;
+    simplechess::Search selective(board);
+    REQUIRE( selective.options().nullMovePruning );
+    REQUIRE( selective.options().lateMoveReductions );
+    REQUIRE( selective.options().futilityPruning );
+    REQUIRE( selective.options().razoring );
+    selective.search(evaluator, limits);
+
+    SearchOptions options;
+    options.nullMovePruning = false;
+    options.lateMoveReductions = false;
+    options.futilityPruning = false;
+    options.razoring = false;
+    simplechess::Search full(board);
+    full.setOptions(options);
+    REQUIRE_FALSE( full.options().nullMovePruning );
+    full.search(evaluator, limits);
+
+    REQUIRE( selective.depth() == 5 );
+    REQUIRE( full.depth() == 5 );
+    REQUIRE( selective.nodes() < full.nodes() );
+  }
+
+  SECTION("null move pruning verifies zugzwang positions")
+  {
+    // Kh6 is the winning move, because it puts black into zugzwang. Without
+    // verification, the null move search in the positions of black does not
+    // see that, and the search misses Kh6 at this depth.
+    REQUIRE( board.fromFEN("1q1k4/2Rr4/8/2Q3K1/8/8/8/8 w - - 0 1") );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    SearchLimits limits;
+    limits.depth = 7;
+    simplechess::Search s(board);
+    REQUIRE( s.options().nullMovePruning );
+    s.search(evaluator, limits);
+    REQUIRE( s.depth() == 7 );
+    const auto bestMove = s.bestMove();
+    REQUIRE( std::get<0>(bestMove) == Field::g5 );
+    REQUIRE( std::get<1>(bestMove) == Field::h6 );
+  }
+
+  SECTION("iterative deepening stops at maximum depth")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR") );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    simplechess::Search s(board);
+    s.search(evaluator, 3, std::chrono::milliseconds(60000));
+    REQUIRE( s.depth() == 3 );
+    REQUIRE( s.hasMove() );
+    const auto bestMove = s.bestMove();
+    REQUIRE( board.move(std::get<0>(bestMove), std::get<1>(bestMove), std::get<2>(bestMove)) );
+  }
+
+  SECTION("iterative deepening completes at least one iteration")
+  {
+    REQUIRE( board.fromFEN("r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3") );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    simplechess::Search s(board);
+    // Without any time there is still the result of the first iteration.
+    s.search(evaluator, 100, std::chrono::milliseconds(0));
+    REQUIRE( s.depth() >= 1 );
+    REQUIRE( s.depth() < 100 );
+    REQUIRE( s.hasMove() );
+    const auto bestMove = s.bestMove();
+    REQUIRE( board.move(std::get<0>(bestMove), std::get<1>(bestMove), std::get<2>(bestMove)) );
+  }
+
+  SECTION("iterative deepening stops when time is up")
+  {
+    REQUIRE( board.fromFEN("r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3") );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    simplechess::Search s(board);
+    const auto start = std::chrono::steady_clock::now();
+    s.search(evaluator, 100, std::chrono::milliseconds(200));
+    const auto duration = std::chrono::steady_clock::now() - start;
+    REQUIRE( duration < std::chrono::seconds(2) );
+    REQUIRE( s.depth() >= 1 );
+    REQUIRE( s.hasMove() );
+  }
+
+  SECTION("iterative deepening stops at the node limit")
+  {
+    REQUIRE( board.fromFEN("r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3") );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    simplechess::Search s(board);
+    SearchLimits limits;
+    limits.nodes = 20000;
+    s.search(evaluator, limits);
+    REQUIRE( s.nodes() <= 20000 );
+    REQUIRE( s.depth() >= 1 );
+    REQUIRE( s.depth() < SearchLimits::defaultDepth );
+    REQUIRE( s.hasMove() );
+  }
+
+  SECTION("iterative deepening without time limit stops at maximum depth")
+  {
+    REQUIRE( board.fromFEN("r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3") );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    simplechess::Search s(board);
+    SearchLimits limits;
+    limits.depth = 3;
+    s.search(evaluator, limits);
+    REQUIRE( s.depth() == 3 );
+    REQUIRE( s.hasMove() );
+  }
+
+  SECTION("iterative deepening does not start new iteration after soft limit")
+  {
+    REQUIRE( board.fromFEN("r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3") );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    simplechess::Search s(board);
+    SearchLimits limits;
+    limits.softTime = std::chrono::milliseconds(0);
+    limits.hardTime = std::chrono::milliseconds(60000);
+    s.search(evaluator, limits);
+    REQUIRE( s.depth() == 1 );
+    REQUIRE( s.hasMove() );
+  }
+
+  SECTION("time limits start after ponder hit")
+  {
+    REQUIRE( board.fromFEN("r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3") );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    simplechess::Search s(board);
+    std::atomic<bool> pondering(true);
+    s.setPonderSignal(pondering);
+    SearchLimits limits;
+    limits.softTime = std::chrono::milliseconds(50);
+    limits.hardTime = std::chrono::milliseconds(100);
+    const auto start = std::chrono::steady_clock::now();
+    std::thread hit([&pondering]()
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(300));
+      pondering.store(false);
+    });
+    s.search(evaluator, limits);
+    const auto duration = std::chrono::steady_clock::now() - start;
+    hit.join();
+    REQUIRE( duration >= std::chrono::milliseconds(300) );
+    REQUIRE( duration < std::chrono::seconds(3) );
+    REQUIRE( s.hasMove() );
+  }
+
+  SECTION("info callback gets statistics of each iteration")
+  {
+    REQUIRE( board.fromFEN("r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3") );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    simplechess::Search s(board);
+    std::vector<SearchInfo> infos;
+    s.setInfoCallback([&infos](const SearchInfo& info) { if (info.completed) infos.push_back(info); });
+    SearchLimits limits;
+    limits.depth = 4;
+    s.search(evaluator, limits);
+    REQUIRE( infos.size() == 4 );
+    for (unsigned int i = 0; i < infos.size(); ++i)
+    {
+      REQUIRE( infos[i].depth == i + 1 );
+      REQUIRE( infos[i].selectiveDepth >= infos[i].depth );
+      REQUIRE( infos[i].nodes > 0 );
+      REQUIRE_FALSE( infos[i].pv.empty() );
+      REQUIRE( infos[i].pv.size() <= infos[i].depth );
+      if (i > 0)
+      {
+        REQUIRE( infos[i].nodes > infos[i - 1].nodes );
+      }
+    }
+    const auto bestMove = s.bestMove();
+    const Move& first = s.principalVariation().front();
+    REQUIRE( first.from == std::get<0>(bestMove) );
+    REQUIRE( first.to == std::get<1>(bestMove) );
+    REQUIRE( infos.back().score == s.score() );
+    REQUIRE( infos.back().nodes == s.nodes() );
+  }
+
+  SECTION("iterative deepening finds checkmate")
+  {
+    REQUIRE( board.fromFEN("rnbqkbnr/pppp1ppp/8/4p3/6P1/5P2/PPPPP2P/RNBQKBNR b KQkq g3 0 2") );
+
+    CompoundEvaluator evaluator;
+    evaluator.add(std::unique_ptr<Evaluator>(new MaterialEvaluator()));
+    simplechess::Search s(board);
+    s.search(evaluator, 100, std::chrono::milliseconds(60000));
+    // Search stops after the mate has been found.
+    REQUIRE( s.depth() < 100 );
+    const auto bestMove = s.bestMove();
+    REQUIRE( std::get<0>(bestMove) == Field::d8 );
+    REQUIRE( std::get<1>(bestMove) == Field::h4 );
+    REQUIRE( s.score() == Search::mateScore - 1 );
+  }
+
+  SECTION("quiescence search sees recapture")
+  {
+    // The white queen can take the pawn on d5, but the pawn is protected by
+    // the pawn on e6. A search of depth one only finds that with the help of
+    // the quiescence search.
+    REQUIRE( board.fromFEN("4k3/8/4p3/3p4/8/8/3Q4/4K3 w - - 0 1") );
+
+    CompoundEvaluator evaluator;
+    evaluator.add(std::unique_ptr<Evaluator>(new MaterialEvaluator()));
+    simplechess::Search s(board);
+    s.search(evaluator, 1);
+    REQUIRE( s.hasMove() );
+    const auto bestMove = s.bestMove();
+    REQUIRE_FALSE( ((std::get<0>(bestMove) == Field::d2) && (std::get<1>(bestMove) == Field::d5)) );
+    // The quiescence search has visited the capture sequence.
+    REQUIRE( s.quiescenceNodes() > 0 );
+    REQUIRE( s.quiescenceNodes() < s.nodes() );
+  }
+
+  SECTION("quiescence search sees checkmate behind the horizon")
+  {
+    // Ra8 is checkmate, but a search of depth one only sees that when the
+    // quiescence search tries all evasions of black. Without that, capturing
+    // the knight looks better, because the evaluator does not know checkmate.
+    REQUIRE( board.fromFEN("6k1/5ppp/8/8/8/8/8/R2n2K1 w - - 0 1") );
+
+    CompoundEvaluator evaluator;
+    evaluator.add(std::unique_ptr<Evaluator>(new MaterialEvaluator()));
+    simplechess::Search s(board);
+    s.search(evaluator, 1);
+    REQUIRE( s.hasMove() );
+    const auto bestMove = s.bestMove();
+    REQUIRE( std::get<0>(bestMove) == Field::a1 );
+    REQUIRE( std::get<1>(bestMove) == Field::a8 );
+    REQUIRE( s.score() == Search::mateScore - 1 );
+  }
+
+  SECTION("repetition of a position from the game history is a draw")
+  {
+    // Black is a queen ahead. But the game history shows that the position
+    // after Kh1-g1 already occurred, so white can claim a draw.
+    REQUIRE( board.fromFEN("k7/8/8/8/8/8/1q6/7K w - - 0 1") );
+    std::vector<std::uint64_t> history;
+    history.push_back(board.hash());
+    REQUIRE( board.move(Field::h1, Field::g1, PieceType::queen) );
+    history.push_back(board.hash());
+    REQUIRE( board.move(Field::a8, Field::a7, PieceType::queen) );
+    history.push_back(board.hash());
+    REQUIRE( board.move(Field::g1, Field::h1, PieceType::queen) );
+    history.push_back(board.hash());
+    REQUIRE( board.move(Field::a7, Field::a8, PieceType::queen) );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    simplechess::Search without(board);
+    without.search(evaluator, 3);
+    REQUIRE( without.score() < -500 );
+
+    simplechess::Search s(board);
+    s.setGameHistory(history);
+    s.search(evaluator, 3);
+    REQUIRE( s.hasMove() );
+    const auto bestMove = s.bestMove();
+    REQUIRE( std::get<0>(bestMove) == Field::h1 );
+    REQUIRE( std::get<1>(bestMove) == Field::g1 );
+    REQUIRE( s.score() == 0 );
+  }
+
+  SECTION("50 move rule ends the game in a draw")
+  {
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+
+    REQUIRE( board.fromFEN("4k3/8/8/8/8/8/8/Q3K3 w - - 0 80") );
+    simplechess::Search normal(board);
+    normal.search(evaluator, 3);
+    REQUIRE( normal.score() > 500 );
+
+    // Every move of white is the 100th half move without pawn move or capture.
+    REQUIRE( board.fromFEN("4k3/8/8/8/8/8/8/Q3K3 w - - 99 80") );
+    simplechess::Search s(board);
+    s.search(evaluator, 3);
+    REQUIRE( s.hasMove() );
+    REQUIRE( s.score() == 0 );
+  }
+
+  SECTION("checkmate on the 100th half move is not a draw")
+  {
+    CompoundEvaluator evaluator;
+    evaluator.add(std::unique_ptr<Evaluator>(new MaterialEvaluator()));
+
+    // Ra8 is the 100th half move without pawn move or capture, but it is
+    // checkmate, too.
+    REQUIRE( board.fromFEN("6k1/5ppp/8/8/8/8/8/R5K1 w - - 99 80") );
+    simplechess::Search s(board);
+    s.search(evaluator, 2);
+    REQUIRE( s.hasMove() );
+    const auto bestMove = s.bestMove();
+    REQUIRE( std::get<0>(bestMove) == Field::a1 );
+    REQUIRE( std::get<1>(bestMove) == Field::a8 );
+    REQUIRE( s.score() == Search::mateScore - 1 );
+  }
+
+  SECTION("insufficient material is a draw")
+  {
+    REQUIRE( board.fromFEN("4k3/8/8/8/8/8/8/4KN2 w - - 0 1") );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    simplechess::Search s(board);
+    s.search(evaluator, 3);
+    REQUIRE( s.hasMove() );
+    REQUIRE( s.score() == 0 );
+  }
+
+  SECTION("multi-threaded search")
+  {
+    REQUIRE( board.fromFEN("r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3") );
+
+    CompoundEvaluator evaluator;
+    CompoundCreator::getDefault(evaluator);
+    simplechess::Search s(board);
+    REQUIRE( s.threads() == 1 );
+    s.setThreads(0);
+    REQUIRE( s.threads() == 1 );
+    s.setThreads(100000);
+    REQUIRE( s.threads() == Search::maxThreads );
+    s.setThreads(4);
+    REQUIRE( s.threads() == 4 );
+
+    s.search(evaluator, 3, std::chrono::milliseconds(60000));
+    REQUIRE( s.depth() >= 3 );
+    REQUIRE( s.hasMove() );
+    const auto bestMove = s.bestMove();
+    REQUIRE( board.move(std::get<0>(bestMove), std::get<1>(bestMove), std::get<2>(bestMove)) );
+  }
 }
@@ -0,0 +1,161 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the test suite for simple-chess.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+
+
+#include "../../locate_catch.hpp"
+#include "../../../libsimple-chess/search/TranspositionTable.hpp"
+
+TEST_CASE("TranspositionTable")
+{
+  using namespace simplechess;
+
+  SECTION("size")
+  {
+    TranspositionTable table;
+    REQUIRE( table.size() == TranspositionTable::defaultSize );
+
+    table.resize(2);
+    REQUIRE( table.size() == 2 );
+
+    // Size is clamped to at least one megabyte.
+    table.resize(0);
+    REQUIRE( table.size() == 1 );
+  }
+
+  SECTION("empty table has no entries")
+  {
+    TranspositionTable table(1);
+    TranspositionTable::Entry entry;
+    REQUIRE_FALSE( table.probe(0x123456789ABCDEF0ULL, entry) );
+    REQUIRE( table.hashfull() == 0 );
+  }
+
+  SECTION("store and probe")
+  {
+    TranspositionTable table(1);
+    const std::uint64_t hash = 0x123456789ABCDEF0ULL;
+    table.store(hash, 5, Bound::lower, -1234, Move(Field::e7, Field::e8, PieceType::knight));
+
+    TranspositionTable::Entry entry;
+    REQUIRE( table.probe(hash, entry) );
+    REQUIRE( entry.depth == 5 );
+    REQUIRE( entry.bound == Bound::lower );
+    REQUIRE( entry.score == -1234 );
+    REQUIRE( entry.move == Move(Field::e7, Field::e8, PieceType::knight) );
+
+    // Different hash in the same bucket must not match.
+    REQUIRE_FALSE( table.probe(hash ^ 0xFF00000000000000ULL, entry) );
+
+    // Large scores like mate scores must survive.
+    table.store(hash, 7, Bound::exact, 100000000, Move(Field::a1, Field::a8));
+    REQUIRE( table.probe(hash, entry) );
+    REQUIRE( entry.depth == 7 );
+    REQUIRE( entry.bound == Bound::exact );
+    REQUIRE( entry.score == 100000000 );
+    REQUIRE( entry.move == Move(Field::a1, Field::a8) );
+  }
+
+  SECTION("empty move keeps previous best move")
+  {
+    TranspositionTable table(1);
+    const std::uint64_t hash = 0xFEDCBA9876543210ULL;
+    table.store(hash, 3, Bound::exact, 50, Move(Field::g1, Field::f3));
+    table.store(hash, 4, Bound::upper, 20, Move());
+
+    TranspositionTable::Entry entry;
+    REQUIRE( table.probe(hash, entry) );
+    REQUIRE( entry.depth == 4 );
+    REQUIRE( entry.bound == Bound::upper );
+    REQUIRE( entry.score == 20 );
+    REQUIRE( entry.move == Move(Field::g1, Field::f3) );
+  }
+
+  SECTION("move without bound keeps previous score")
+  {
+    TranspositionTable table(1);
+    const std::uint64_t hash = 0x0F1E2D3C4B5A6978ULL;
+    table.store(hash, 6, Bound::lower, 75, Move(Field::g1, Field::f3));
+    table.store(hash, 2, Bound::none, 0, Move(Field::e2, Field::e4));
+
+    TranspositionTable::Entry entry;
+    REQUIRE( table.probe(hash, entry) );
+    REQUIRE( entry.depth == 6 );
+    REQUIRE( entry.bound == Bound::lower );
+    REQUIRE( entry.score == 75 );
+    REQUIRE( entry.move == Move(Field::e2, Field::e4) );
+
+    // Without an existing entry, only the move is of interest.
+    const std::uint64_t other = 0x1122334455667788ULL;
+    table.store(other, 0, Bound::none, 0, Move(Field::d2, Field::d4));
+    REQUIRE( table.probe(other, entry) );
+    REQUIRE( entry.bound == Bound::none );
+    REQUIRE( entry.move == Move(Field::d2, Field::d4) );
+
+    // Neither bound nor move: nothing is stored.
+    const std::uint64_t nothing = 0x8877665544332211ULL;
+    table.store(nothing, 0, Bound::none, 0, Move());
+    REQUIRE_FALSE( table.probe(nothing, entry) );
+  }
+
+  SECTION("replacement prefers shallow and old entries")
+  {
+    TranspositionTable table(1);
+    // All hashes share the same bucket, because the lower bits are equal.
+    const std::uint64_t base = 0x0000000000000042ULL;
+    const auto hashOf = [base](std::uint64_t i) { return base | (i << 40); };
+    table.store(hashOf(1), 10, Bound::exact, 1, Move());
+    table.store(hashOf(2), 2, Bound::exact, 2, Move());
+    table.store(hashOf(3), 10, Bound::exact, 3, Move());
+    table.store(hashOf(4), 10, Bound::exact, 4, Move());
+    // Bucket is full now, so the next entry replaces the shallowest one.
+    table.store(hashOf(5), 5, Bound::exact, 5, Move());
+
+    TranspositionTable::Entry entry;
+    REQUIRE( table.probe(hashOf(1), entry) );
+    REQUIRE_FALSE( table.probe(hashOf(2), entry) );
+    REQUIRE( table.probe(hashOf(3), entry) );
+    REQUIRE( table.probe(hashOf(4), entry) );
+    REQUIRE( table.probe(hashOf(5), entry) );
+
+    // Entries from older searches get replaced, even if they are deeper.
+    table.newSearch();
+    table.newSearch();
+    table.store(hashOf(6), 1, Bound::exact, 6, Move());
+    REQUIRE( table.probe(hashOf(6), entry) );
+    REQUIRE_FALSE( table.probe(hashOf(5), entry) );
+  }
+
+  SECTION("clear removes all entries")
+  {
+    TranspositionTable table(1);
+    for (std::uint64_t i = 0; i < 100000; ++i)
+    {
+      table.store(i * 0x9E3779B97F4A7C15ULL, 1, Bound::exact, 0, Move());
+    }
+    REQUIRE( table.hashfull() > 0 );
+    TranspositionTable::Entry entry;
+    REQUIRE( table.probe(99999 * 0x9E3779B97F4A7C15ULL, entry) );
+
+    table.clear();
+    REQUIRE( table.hashfull() == 0 );
+    REQUIRE_FALSE( table.probe(99999 * 0x9E3779B97F4A7C15ULL, entry) );
+  }
+}